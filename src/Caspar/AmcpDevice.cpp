@@ -84,14 +84,71 @@ const QString& AmcpDevice::getAddress() const
     return this->address;
 }
 
+void AmcpDevice::beginBatch()
+{
+    if (this->batchDepth++ > 0)
+        return;
+
+    this->batch.clear();
+    this->batchCount = 0;
+}
+
+void AmcpDevice::endBatch()
+{
+    if (this->batchDepth == 0 || --this->batchDepth > 0)
+        return;
+
+    if (this->batch.isEmpty())
+        return;
+
+    // The skew is the time between the first and the last command of the batch leaving the client.
+    qint64 skew = this->batchTimer.nsecsElapsed() / 1000;
+    if (this->connected && !this->disableCommands)
+    {
+        this->socket->write(this->batch);
+        this->socket->flush();
+
+        qDebug("Sent %d messages to %s:%d in a single write, %lld us skew", this->batchCount, qPrintable(this->address), this->port, skew);
+    }
+
+    this->batch.clear();
+    this->batchCount = 0;
+}
+
+QByteArray AmcpDevice::encodeMessage(const QString& message)
+{
+    if (message.trimmed().isEmpty())
+        return QByteArray();
+
+    return QString("%1\r\n").arg(message.trimmed()).toUtf8();
+}
+
 void AmcpDevice::writeMessage(const QString& message)
 {
     if (this->connected && !this->disableCommands)
+        writeEncodedMessage(encodeMessage(message));
+}
+
+void AmcpDevice::writeEncodedMessage(const QByteArray& message)
+{
+    if (!this->connected || this->disableCommands || message.isEmpty())
+        return;
+
+    if (this->batchDepth > 0)
+    {
+        if (this->batchCount++ == 0)
+            this->batchTimer.start();
+
+        this->batch.append(message);
+
+        qDebug("Batched message to %s:%d: %s\\r\\n", qPrintable(this->address), this->port, message.trimmed().constData());
+    }
+    else
     {
-        this->socket->write(QString("%1\r\n").arg(message.trimmed()).toUtf8());
+        this->socket->write(message);
         this->socket->flush();
 
-        qDebug("Sent message to %s:%d: %s\\r\\n", qPrintable(this->address), this->port, qPrintable(message.trimmed()));
+        qDebug("Sent message to %s:%d: %s\\r\\n", qPrintable(this->address), this->port, message.trimmed().constData());
     }
 }
 
@@ -2,6 +2,8 @@
 
 #include "Shared.h"
 
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
 
 class QObject;
@@ -20,6 +22,13 @@ class CASPAR_EXPORT AmcpDevice : public QObject
 
         void setDisableCommands(bool disable);
 
+        void beginBatch();
+        void endBatch();
+
+        void writeEncodedMessage(const QByteArray& message);
+
+        static QByteArray encodeMessage(const QString& message);
+
         bool isConnected() const;
         int getPort() const;
         const QString& getAddress() const;
@@ -84,6 +93,11 @@ class CASPAR_EXPORT AmcpDevice : public QObject
         bool connected = false;
         bool disableCommands = false;
 
+        int batchDepth = 0;
+        int batchCount = 0;
+        QByteArray batch;
+        QElapsedTimer batchTimer;
+
         QString fragments;
 
         QTextDecoder* decoder = nullptr;
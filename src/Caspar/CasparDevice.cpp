@@ -53,6 +53,55 @@ void CasparDevice::refreshTemplateHostVersion()
     writeMessage("VERSION TEMPLATEHOST");
 }
 
+void CasparDevice::beginGroup()
+{
+    if (this->groupDepth++ == 0)
+        this->deferredChannels.clear();
+
+    beginBatch();
+}
+
+void CasparDevice::commitGroup()
+{
+    if (this->groupDepth == 0)
+        return;
+
+    // Every channel touched by the group is committed once, after all of its commands.
+    if (--this->groupDepth == 0)
+    {
+        foreach (int channel, this->deferredChannels)
+            setCommit(channel);
+
+        this->deferredChannels.clear();
+    }
+
+    endBatch();
+}
+
+QString CasparDevice::getDeferArgument(int channel, bool defer)
+{
+    if (defer)
+    {
+        // Deferred by the operator for a later commit, what the group deferred on this channel is committed first.
+        if (this->deferredChannels.removeAll(channel) > 0)
+            setCommit(channel);
+
+        if (!this->pendingChannels.contains(channel))
+            this->pendingChannels.append(channel);
+
+        return "DEFER";
+    }
+
+    // A commit by the group would apply the transforms the operator deferred on the channel.
+    if (this->groupDepth == 0 || this->pendingChannels.contains(channel))
+        return "";
+
+    if (!this->deferredChannels.contains(channel))
+        this->deferredChannels.append(channel);
+
+    return "DEFER";
+}
+
 void CasparDevice::refreshMedia()
 {
     writeMessage("CLS");
@@ -86,6 +135,8 @@ void CasparDevice::sendCommand(const QString& command)
 void CasparDevice::clearChannel(int channel)
 {
     writeMessage(QString("CLEAR %1").arg(channel));
+
+    emit layerCleared(channel, -1, *this); // Every layer of the channel.
 }
 
 void CasparDevice::clearMixerChannel(int channel)
@@ -96,6 +147,8 @@ void CasparDevice::clearMixerChannel(int channel)
 void CasparDevice::clearVideolayer(int channel, int videolayer)
 {
     writeMessage(QString("CLEAR %1-%2").arg(channel).arg(videolayer));
+
+    emit layerCleared(channel, videolayer, *this);
 }
 
 void CasparDevice::clearMixerVideolayer(int channel, int videolayer)
@@ -115,12 +168,22 @@ void CasparDevice::resume(int channel, int videolayer)
 
 void CasparDevice::stop(int channel, int videolayer)
 {
-    writeMessage(QString("STOP %1-%2").arg(channel).arg(videolayer));
+    writeMessage(getStopMessage(channel, videolayer));
+}
+
+QString CasparDevice::getStopMessage(int channel, int videolayer)
+{
+    return QString("STOP %1-%2").arg(channel).arg(videolayer);
 }
 
 void CasparDevice::play(int channel, int videolayer)
 {
-    writeMessage(QString("PLAY %1-%2").arg(channel).arg(videolayer));
+    writeMessage(getPlayMessage(channel, videolayer));
+}
+
+QString CasparDevice::getPlayMessage(int channel, int videolayer)
+{
+    return QString("PLAY %1-%2").arg(channel).arg(videolayer);
 }
 
 void CasparDevice::print(int channel, const QString& output)
@@ -237,52 +300,77 @@ void CasparDevice::loadHtml(int channel, int videolayer, const QString& url, con
 
 void CasparDevice::playMovie(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto)
+{
+    writeMessage(getPlayMovieMessage(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, useAuto));
+}
+
+QString CasparDevice::getPlayMovieMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto)
 {
     if (useAuto)
-        loadMovie(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, false, useAuto);
-    else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8 %9 %10")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction)
-                     .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
-                     .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
-                     .arg((loop == true) ? "LOOP" : ""));
+        return getLoadMovieMessage(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, false, useAuto);
+
+    return QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8 %9 %10")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction)
+           .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
+           .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
+           .arg((loop == true) ? "LOOP" : "");
 }
 
 void CasparDevice::loadMovie(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, int seek, int length, bool loop,
                              bool freezeOnLoad, bool useAuto)
 {
-    writeMessage(QString("%1 %2-%3 \"%4\" %5 %6 %7 %8 %9 %10 %11 %12")
-                 .arg((freezeOnLoad == true) ? "LOAD" : "LOADBG")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
-                 .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
-                 .arg((loop == true) ? "LOOP" : "")
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    writeMessage(getLoadMovieMessage(channel, videolayer, name, transition, duration, easing, direction, seek, length, loop, freezeOnLoad, useAuto));
+}
+
+QString CasparDevice::getLoadMovieMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, int seek, int length, bool loop,
+                                          bool freezeOnLoad, bool useAuto)
+{
+    return QString("%1 %2-%3 \"%4\" %5 %6 %7 %8 %9 %10 %11 %12")
+           .arg((freezeOnLoad == true) ? "LOAD" : "LOADBG")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction)
+           .arg((seek > 0) ? QString("SEEK %1").arg(seek) : "")
+           .arg((length > 0) ? QString("LENGTH %1").arg(length) : "")
+           .arg((loop == true) ? "LOOP" : "")
+           .arg((useAuto == true) ? "AUTO" : "");
 }
 
 void CasparDevice::playAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, bool loop, bool useAuto)
+{
+    writeMessage(getPlayAudioMessage(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto));
+}
+
+QString CasparDevice::getPlayAudioMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, bool loop, bool useAuto)
 {
     if (useAuto)
-        loadAudio(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto);
-    else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction)
-                     .arg((loop == true) ? "LOOP" : ""));
+        return getLoadAudioMessage(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto);
+
+    return QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7 %8")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction)
+           .arg((loop == true) ? "LOOP" : "");
 }
 
 void CasparDevice::loadAudio(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, bool loop, bool useAuto)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7 %8 %9")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((loop == true) ? "LOOP" : "")
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    writeMessage(getLoadAudioMessage(channel, videolayer, name, transition, duration, easing, direction, loop, useAuto));
+}
+
+QString CasparDevice::getLoadAudioMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, bool loop, bool useAuto)
+{
+    return QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7 %8 %9")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction)
+           .arg((loop == true) ? "LOOP" : "")
+           .arg((useAuto == true) ? "AUTO" : "");
 }
 
 void CasparDevice::playColor(int channel, int videolayer, const QString& color, const QString &transition, int duration,
@@ -307,22 +395,34 @@ void CasparDevice::loadColor(int channel, int videolayer, const QString& color,
 
 void CasparDevice::playStill(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, bool useAuto)
+{
+    writeMessage(getPlayStillMessage(channel, videolayer, name, transition, duration, easing, direction, useAuto));
+}
+
+QString CasparDevice::getPlayStillMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, bool useAuto)
 {
     if (useAuto)
-        loadStill(channel, videolayer, name, transition, duration, easing, direction, useAuto);
-    else
-        writeMessage(QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7")
-                     .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                     .arg(direction));
+        return getLoadStillMessage(channel, videolayer, name, transition, duration, easing, direction, useAuto);
+
+    return QString("PLAY %1-%2 \"%3\" %4 %5 %6 %7")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction);
 }
 
 void CasparDevice::loadStill(int channel, int videolayer, const QString& name, const QString& transition, int duration,
                              const QString& easing, const QString& direction, bool useAuto)
 {
-    writeMessage(QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7")
-                 .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
-                 .arg(direction)
-                 .arg((useAuto == true) ? "AUTO" : ""));
+    writeMessage(getLoadStillMessage(channel, videolayer, name, transition, duration, easing, direction, useAuto));
+}
+
+QString CasparDevice::getLoadStillMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration,
+                                          const QString& easing, const QString& direction, bool useAuto)
+{
+    return QString("LOADBG %1-%2 \"%3\" %4 %5 %6 %7")
+           .arg(channel).arg(videolayer).arg(name).arg(transition).arg(duration).arg(easing)
+           .arg(direction)
+           .arg((useAuto == true) ? "AUTO" : "");
 }
 
 void CasparDevice::startFileRecorder(int channel, const QString& filename, const QString& codec, const QString& preset,
@@ -396,6 +496,8 @@ void CasparDevice::setReset(int channel, int videolayer)
 
 void CasparDevice::setCommit(int channel)
 {
+    this->pendingChannels.removeAll(channel);
+
     writeMessage(QString("MIXER %1 COMMIT").arg(channel));
 }
 
@@ -421,84 +523,84 @@ void CasparDevice::setGrid(int channel, int grid, int duration, const QString& e
 {
     writeMessage(QString("MIXER %1 GRID %2 %3 %4 %5")
                  .arg(channel).arg(grid).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setKeyer(int channel, int videolayer, int keyer, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 KEYER %3 %4")
                  .arg(channel).arg(videolayer).arg(keyer)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setVolume(int channel, int videolayer, float volume, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 VOLUME %3 %4")
                  .arg(channel).arg(videolayer).arg(volume)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setVolume(int channel, int videolayer, float volume, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 VOLUME %3 %4 %5 %6")
                  .arg(channel).arg(videolayer).arg(volume).arg(duration)
-                 .arg(easing).arg((defer == true) ? "DEFER" : ""));
+                 .arg(easing).arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setOpacity(int channel, int videolayer, float opacity, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 OPACITY %3 %4")
                  .arg(channel).arg(videolayer).arg(opacity)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setOpacity(int channel, int videolayer, float opacity, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 OPACITY %3 %4 %5 %6")
                  .arg(channel).arg(videolayer).arg(opacity).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setBrightness(int channel, int videolayer, float brightness, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 BRIGHTNESS %3 %4")
                  .arg(channel).arg(videolayer).arg(brightness)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setBrightness(int channel, int videolayer, float brightness, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 BRIGHTNESS %3 %4 %5 %6")
                 .arg(channel).arg(videolayer).arg(brightness).arg(duration).arg(easing)
-                .arg((defer == true) ? "DEFER" : ""));
+                .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setContrast(int channel, int videolayer, float contrast, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 CONTRAST %3 %4")
                  .arg(channel).arg(videolayer).arg(contrast)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setContrast(int channel, int videolayer, float contrast, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 CONTRAST %3 %4 %5 %6")
                  .arg(channel).arg(videolayer).arg(contrast).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setSaturation(int channel, int videolayer, float saturation, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 SATURATION %3 %4")
                  .arg(channel).arg(videolayer).arg(saturation)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setSaturation(int channel, int videolayer, float saturation, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 SATURATION %3 %4 %5 %6")
                  .arg(channel).arg(videolayer).arg(saturation).arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
@@ -506,7 +608,7 @@ void CasparDevice::setLevels(int channel, int videolayer, float minIn, float max
 {
     writeMessage(QString("MIXER %1-%2 LEVELS %3 %4 %5 %6 %7 %8")
                  .arg(channel).arg(videolayer).arg(minIn).arg(maxIn).arg(gamma).arg(minOut).arg(maxOut)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setLevels(int channel, int videolayer, float minIn, float maxIn, float gamma, float minOut, float maxOut,
@@ -515,7 +617,7 @@ void CasparDevice::setLevels(int channel, int videolayer, float minIn, float max
     writeMessage(QString("MIXER %1-%2 LEVELS %3 %4 %5 %6 %7 %8 %9 %10")
                  .arg(channel).arg(videolayer).arg(minIn).arg(maxIn).arg(gamma).arg(minOut).arg(maxOut)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setFill(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
@@ -524,7 +626,7 @@ void CasparDevice::setFill(int channel, int videolayer, float positionX, float p
     writeMessage(QString("MIXER %1-%2 MIPMAP %3").arg(channel).arg(videolayer).arg((useMipmap == true) ? "1" : "0"));
     writeMessage(QString("MIXER %1-%2 FILL %3 %4 %5 %6 %7")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setFill(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
@@ -534,7 +636,7 @@ void CasparDevice::setFill(int channel, int videolayer, float positionX, float p
     writeMessage(QString("MIXER %1-%2 FILL %3 %4 %5 %6 %7 %8 %9")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
@@ -542,7 +644,7 @@ void CasparDevice::setClipping(int channel, int videolayer, float positionX, flo
 {
     writeMessage(QString("MIXER %1-%2 CLIP %3 %4 %5 %6 %7")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX)
-                 .arg(scaleY).arg((defer == true) ? "DEFER" : ""));
+                 .arg(scaleY).arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setClipping(int channel, int videolayer, float positionX, float positionY, float scaleX, float scaleY,
@@ -551,14 +653,14 @@ void CasparDevice::setClipping(int channel, int videolayer, float positionX, flo
     writeMessage(QString("MIXER %1-%2 CLIP %3 %4 %5 %6 %7 %8 %9")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY).arg(scaleX).arg(scaleY)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setCrop(int channel, int videolayer, float upperLeftX, float upperLeftY, float lowerRightX, float lowerRightY, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 CROP %3 %4 %5 %6 %7")
                  .arg(channel).arg(videolayer).arg(upperLeftX).arg(upperLeftY).arg(lowerRightX).arg(lowerRightY)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setCrop(int channel, int videolayer, float upperLeftX, float upperLeftY, float lowerRightX, float lowerRightY, int duration, const QString& easing, bool defer)
@@ -566,7 +668,7 @@ void CasparDevice::setCrop(int channel, int videolayer, float upperLeftX, float
     writeMessage(QString("MIXER %1-%2 CROP %3 %4 %5 %6 %7 %8 %9")
                  .arg(channel).arg(videolayer).arg(upperLeftX).arg(upperLeftY).arg(lowerRightX).arg(lowerRightY)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setPerspective(int channel, int videolayer, float upperLeftX, float upperLeftY, float upperRightX, float upperRightY,
@@ -577,7 +679,7 @@ void CasparDevice::setPerspective(int channel, int videolayer, float upperLeftX,
                  .arg(channel).arg(videolayer)
                  .arg(upperLeftX).arg(upperLeftY).arg(upperRightX).arg(upperRightY)
                  .arg(lowerRightX).arg(lowerRightY).arg(lowerLeftX).arg(lowerLeftY)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setPerspective(int channel, int videolayer, float upperLeftX, float upperLeftY, float upperRightX, float upperRightY,
@@ -589,28 +691,28 @@ void CasparDevice::setPerspective(int channel, int videolayer, float upperLeftX,
                  .arg(upperLeftX).arg(upperLeftY).arg(upperRightX).arg(upperRightY)
                  .arg(lowerRightX).arg(lowerRightY).arg(lowerLeftX).arg(lowerLeftY)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setRotation(int channel, int videolayer, float rotation, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 ROTATION %3 %4")
                  .arg(channel).arg(videolayer).arg(rotation)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setRotation(int channel, int videolayer, float rotation, int duration, const QString& easing, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 ROTATION %3 %4 %5 %6")
                 .arg(channel).arg(videolayer).arg(rotation).arg(duration).arg(easing)
-                .arg((defer == true) ? "DEFER" : ""));
+                .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setAnchor(int channel, int videolayer, float positionX, float positionY, bool defer)
 {
     writeMessage(QString("MIXER %1-%2 ANCHOR %3 %4 %5")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::setAnchor(int channel, int videolayer, float positionX, float positionY, int duration, const QString& easing, bool defer)
@@ -618,7 +720,7 @@ void CasparDevice::setAnchor(int channel, int videolayer, float positionX, float
     writeMessage(QString("MIXER %1-%2 ANCHOR %3 %4 %5 %6 %7")
                  .arg(channel).arg(videolayer).arg(positionX).arg(positionY)
                  .arg(duration).arg(easing)
-                 .arg((defer == true) ? "DEFER" : ""));
+                 .arg(getDeferArgument(channel, defer)));
 }
 
 void CasparDevice::sendNotification()
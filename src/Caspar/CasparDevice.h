@@ -29,6 +29,18 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         void refreshServerVersion();
         void refreshTemplateHostVersion();
 
+        void beginGroup();
+        void commitGroup();
+
+        static QString getStopMessage(int channel, int videolayer);
+        static QString getPlayMessage(int channel, int videolayer);
+        static QString getPlayMovieMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, int seek, int length, bool loop, bool useAuto);
+        static QString getLoadMovieMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, int seek, int length, bool loop, bool freezeOnLoad, bool useAuto);
+        static QString getPlayAudioMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, bool loop, bool useAuto);
+        static QString getLoadAudioMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, bool loop, bool useAuto);
+        static QString getPlayStillMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, bool useAuto);
+        static QString getLoadStillMessage(int channel, int videolayer, const QString& name, const QString& transition, int duration, const QString& easing, const QString& direction, bool useAuto);
+
         void retrieveThumbnail(const QString& name);
 
         void sendCommand(const QString& command);
@@ -121,6 +133,7 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
         void setMasterVolume(int channel, float masterVolume);
 
         Q_SIGNAL void connectionStateChanged(CasparDevice&);
+        Q_SIGNAL void layerCleared(int, int, CasparDevice&);
         Q_SIGNAL void infoChanged(const QList<QString>&, CasparDevice&);
         Q_SIGNAL void infoSystemChanged(const QList<QString>&, CasparDevice&);
         Q_SIGNAL void mediaChanged(const QList<CasparMedia>&, CasparDevice&);
@@ -134,4 +147,11 @@ class CASPAR_EXPORT CasparDevice : public AmcpDevice
 
     protected:
         void sendNotification();
+
+    private:
+        int groupDepth = 0;
+        QList<int> deferredChannels;
+        QList<int> pendingChannels;
+
+        QString getDeferArgument(int channel, bool defer);
 };
@@ -88,6 +88,7 @@ namespace Osc
     static const bool DEFAULT_TRIGGER_ON_NEXT = false;
     static const int DEFAULT_PORT = 6250;
     static const int DEFAULT_WEBSOCKET_PORT = 4250;
+    static const int DEFAULT_TCP_PORT = 6251;
     static const QString DEFAULT_OUTPUT = "";
     static const QString DEFAULT_TYPE = "String";
     static const int DEFAULT_OUTPUT_PORT = 7250;
@@ -110,13 +111,6 @@ namespace Osc
     static const int COMPACT_PAUSE_X = 102;
     static const int COMPACT_PAUSE_Y = 0;
     static const QString DEFAULT_TIME = "00:00:00:00";
-    static const QString DEFAULT_TIME_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/time";
-    static const QString DEFAULT_FRAME_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/frame";
-    static const QString DEFAULT_FPS_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/fps";
-    static const QString DEFAULT_PATH_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/file/path";
-    static const QString DEFAULT_PAUSED_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/paused";
-    static const QString DEFAULT_LOOP_FILTER = "#IPADDRESS#/channel/#CHANNEL#/stage/layer/#VIDEOLAYER#/loop";
-    static const QString DEFAULT_AUDIO_FILTER = "#IPADDRESS#/channel/#CHANNEL#/mixer/audio/#AUDIOCHANNEL#/dBFS";
     static const QString DEFAULT_STOP_CONTROL_FILTER = "/control/#UID#/stop";
     static const QString DEFAULT_PLAY_CONTROL_FILTER = "/control/#UID#/play";
     static const QString DEFAULT_PLAYNOW_CONTROL_FILTER = "/control/#UID#/playnow";
@@ -474,6 +468,15 @@ namespace Rundown
     static const QString ROUTECHANNEL = "ROUTECHANNEL";
     static const QString ROUTEVIDEOLAYER = "ROUTEVIDEOLAYER";
     static const int MAX_NUMBER_OF_RUNDONWS = 10;
+    static const int LOAD_SLICE_DURATION = 15;
+    static const int LOAD_BATCH_SIZE = 16;
+    static const int HIBERNATE_DELAY = 10000;
+    static const int PREROLL_DELAY = 250;
+    static const int PREROLL_LOOKAHEAD = 50;
+    static const int RELEASE_DELAY = 1000;
+    static const int VIEWPORT_MARGIN = 10;
+    static const int LABEL_ROLE = Qt::UserRole + 1;
+    static const int COLOR_ROLE = Qt::UserRole + 2;
     static const QString DEFAULT_NAME = "New Rundown";
     static const QString DEFAULT_AUDIO_NAME = "Audio";
     static const QString DEFAULT_STILL_NAME = "Image";
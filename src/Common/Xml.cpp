@@ -5,33 +5,45 @@
 QString Xml::encode(const QString& data)
 {
     QString temp;
+    temp.reserve(data.size() + data.size() / 8);
 
+    // Runs of characters that need no escaping are copied at once.
+    const QChar* characters = data.constData();
+    int start = 0;
     for (int index = 0; index < data.size(); index++)
     {
-        QChar character(data.at(index));
-        switch (character.unicode())
+        const char* entity = NULL;
+        switch (characters[index].unicode())
         {
             case '&':
-                temp += "&amp;";
+                entity = "&amp;";
                 break;
             case '\'':
-                temp += "&apos;";
+                entity = "&apos;";
                 break;
             case '"':
-                temp += "&quot;";
+                entity = "&quot;";
                 break;
             case '<':
-                temp += "&lt;";
+                entity = "&lt;";
                 break;
             case '>':
-                temp += "&gt;";
+                entity = "&gt;";
                 break;
             default:
-                temp += character;
-                break;
+                continue;
         }
+
+        temp.append(characters + start, index - start);
+        temp.append(QLatin1String(entity));
+        start = index + 1;
     }
 
+    if (start == 0)
+        return data;
+
+    temp.append(characters + start, data.size() - start);
+
     return temp;
 }
 
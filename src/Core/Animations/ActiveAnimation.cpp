@@ -1,37 +1,144 @@
 #include "ActiveAnimation.h"
 
-#include <QtCore/QPropertyAnimation>
+#include <QtCore/QBasicTimer>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+
+#include <QtGui/QPainter>
 
 #include <QtWidgets/QWidget>
 
+static const int DURATION = 350;
+static const int FRAME_INTERVAL = 16;
+
+/*
+ * Drives every running animation from a single timer that only runs while
+ * at least one animation does.
+ */
+class ActiveAnimationClock : public QObject
+{
+    public:
+        ActiveAnimationClock()
+        {
+            this->elapsedTimer.start();
+        }
+
+        qint64 getTime() const
+        {
+            return this->elapsedTimer.elapsed();
+        }
+
+        void add(ActiveAnimation* animation)
+        {
+            if (!this->animations.contains(animation))
+                this->animations.append(animation);
+
+            if (!this->timer.isActive())
+                this->timer.start(FRAME_INTERVAL, this);
+        }
+
+        void remove(ActiveAnimation* animation)
+        {
+            this->animations.removeAll(animation);
+
+            if (this->animations.isEmpty())
+                this->timer.stop();
+        }
+
+    protected:
+        virtual void timerEvent(QTimerEvent* /* event */)
+        {
+            // An animation that finishes removes itself from the list.
+            qint64 time = getTime();
+            foreach (ActiveAnimation* animation, QList<ActiveAnimation*>(this->animations))
+                animation->advance(time);
+        }
+
+    private:
+        QBasicTimer timer;
+        QElapsedTimer elapsedTimer;
+        QList<ActiveAnimation*> animations;
+};
+
+Q_GLOBAL_STATIC(ActiveAnimationClock, activeAnimationClock)
+
 ActiveAnimation::ActiveAnimation(QWidget* target, QObject* parent)
-    : QObject(parent), target(target)
+    : QObject((parent != nullptr) ? parent : target), target(target)
 {
-    this->animation = new QPropertyAnimation(this, "color");
-    this->animation->setDuration(350);
-    this->animation->setKeyValueAt(0, 255);
-    this->animation->setKeyValueAt(1, 0);
+}
+
+ActiveAnimation::~ActiveAnimation()
+{
+    if (this->running && !activeAnimationClock.isDestroyed())
+        activeAnimationClock()->remove(this);
 }
 
 void ActiveAnimation::start(int loopCount)
 {
-    this->animation->setLoopCount(loopCount);
-    this->animation->start();
+    // Most rundown items never flash, the target is only filtered after the first one.
+    if (!this->painted)
+        this->target->installEventFilter(this);
+
+    this->loopCount = loopCount;
+    this->startTime = activeAnimationClock()->getTime();
+    this->running = true;
+    this->painted = true;
+
+    activeAnimationClock()->add(this);
+
+    advance(this->startTime);
 }
 
 void ActiveAnimation::stop()
 {
-    this->animation->stop();
+    if (this->running)
+        activeAnimationClock()->remove(this);
+
+    this->running = false;
+
+    if (this->painted)
+    {
+        // The style sheet of the target shows again.
+        this->painted = false;
+        this->target->removeEventFilter(this);
+        this->target->update();
+    }
 }
 
-int ActiveAnimation::color() const
+void ActiveAnimation::advance(qint64 time)
 {
-    return this->value;
+    qint64 elapsed = time - this->startTime;
+
+    int value;
+    if (this->loopCount >= 0 && elapsed >= qint64(this->loopCount) * DURATION)
+    {
+        // Ends on the last key value, like a finished property animation.
+        value = 0;
+        this->running = false;
+
+        activeAnimationClock()->remove(this);
+    }
+    else
+    {
+        value = 255 - int((elapsed % DURATION) * 255 / DURATION);
+    }
+
+    if (value == this->value && elapsed > 0)
+        return;
+
+    this->value = value;
+    this->target->update();
 }
 
-void ActiveAnimation::setColor(const int value)
+bool ActiveAnimation::eventFilter(QObject* target, QEvent* event)
 {
-    this->value = value;
+    if (target == this->target && event->type() == QEvent::Paint)
+    {
+        QPainter painter(this->target);
+        painter.fillRect(this->target->rect(), QColor(255 - this->value, this->value, 0));
+
+        return true;
+    }
 
-    this->target->setStyleSheet(QString("background-color: rgba(%1, %2, 0, 255);").arg(255 - this->value).arg(this->value));
+    return QObject::eventFilter(target, event);
 }
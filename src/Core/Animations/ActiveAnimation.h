@@ -2,27 +2,39 @@
 
 #include "../Shared.h"
 
+#include <QtCore/QEvent>
 #include <QtCore/QObject>
 
 class QWidget;
-class QPropertyAnimation;
 
+/*
+ * Flashes the active color of a rundown item. The color is painted over the
+ * target instead of being set as a style sheet, so a flash never re-polishes
+ * the widget. All running animations are advanced by one shared clock.
+ */
 class CORE_EXPORT ActiveAnimation : public QObject
 {
     Q_OBJECT
-    Q_PROPERTY(int color READ color WRITE setColor)
 
     public:
         explicit ActiveAnimation(QWidget* target, QObject* parent = 0);
+        ~ActiveAnimation();
 
         void start(int loopCount = -1);
         void stop();
 
+    protected:
+        virtual bool eventFilter(QObject* target, QEvent* event);
+
     private:
         int value = 255;
+        int loopCount = -1;
+        qint64 startTime = 0;
+        bool running = false;
+        bool painted = false;
         QWidget* target = nullptr;
-        QPropertyAnimation* animation = nullptr;
 
-        int color() const;
-        void setColor(const int value);
+        void advance(qint64 time);
+
+        friend class ActiveAnimationClock;
 };
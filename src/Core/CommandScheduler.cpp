@@ -0,0 +1,282 @@
+#include "CommandScheduler.h"
+#include "ScheduledTimer.h"
+#include "DeviceManager.h"
+#include "StageStateManager.h"
+
+#include <QtCore/QMetaObject>
+#include <QtCore/QtMath>
+#include <QtCore/QMutexLocker>
+
+Q_GLOBAL_STATIC(CommandScheduler, commandScheduler)
+
+static const qint64 SPIN_INTERVAL = 1000000; // The last millisecond before a deadline is not left to the OS scheduler.
+static const qint64 FRAME_CLOCK_TIMEOUT = 1000000000;
+static const qint64 LATENESS_WARNING = 5000;
+
+CommandScheduler::CommandScheduler()
+    : nextId(1), firedCount(0), totalLateness(0), maximumLateness(0), maximumSkew(0), batchDepth(0), batchTime(0),
+      dispatchScheduled(false), stopped(false)
+{
+    this->elapsedTimer.start();
+}
+
+CommandScheduler& CommandScheduler::getInstance()
+{
+    return *commandScheduler();
+}
+
+void CommandScheduler::initialize()
+{
+    QThread::start(QThread::TimeCriticalPriority);
+}
+
+void CommandScheduler::uninitialize()
+{
+    {
+        QMutexLocker locker(&this->mutex);
+        this->stopped = true;
+        this->condition.wakeAll();
+    }
+
+    wait();
+
+    if (this->firedCount > 0)
+        qDebug("Command scheduler fired %llu commands, %lld us late on average and %lld us at most",
+               this->firedCount, getAverageLateness(), getMaximumLateness());
+
+    if (this->maximumSkew > 0)
+        qDebug("Command scheduler fired grouped commands with %lld us skew at most", getMaximumSkew());
+}
+
+qint64 CommandScheduler::getTime() const
+{
+    return this->elapsedTimer.nsecsElapsed();
+}
+
+qint64 CommandScheduler::getStartTime() const
+{
+    // Equal delays within a batch give equal deadlines.
+    return (this->batchDepth > 0) ? this->batchTime : getTime();
+}
+
+qint64 CommandScheduler::getFrameDeadline(qint64 start, int frames, double framesPerSecond, const QString& clock) const
+{
+    if (frames <= 0 || framesPerSecond <= 0)
+        return start;
+
+    double period = 1000000000.0 / framesPerSecond;
+    qint64 deadline = start + qRound64(frames * period);
+
+    // Delay to the next frame boundary of the server while it keeps reporting frames, never fire before the requested time.
+    qint64 tick = this->frameClocks.value(clock, -1);
+    if (tick >= 0 && start - tick < FRAME_CLOCK_TIMEOUT)
+        deadline = tick + qRound64(qCeil((deadline - tick) / period) * period);
+
+    return deadline;
+}
+
+void CommandScheduler::updateFrameClock(const QString& clock, qint64 time)
+{
+    // Reports of several layers of the channel may arrive out of order within a batch.
+    if (time > this->frameClocks.value(clock, -1))
+        this->frameClocks[clock] = time;
+}
+
+quint64 CommandScheduler::schedule(ScheduledTimer* timer, qint64 deadline)
+{
+    quint64 id = this->nextId++;
+    this->timers.insert(id, timer);
+
+    if (this->batchDepth > 0)
+    {
+        this->batchedDeadlines.append(qMakePair(deadline, id));
+
+        return id;
+    }
+
+    QMutexLocker locker(&this->mutex);
+    this->deadlines.insert(deadline, id);
+
+    // The worker only has to be woken up when it is waiting for a later deadline.
+    if (this->deadlines.firstKey() == deadline)
+        this->condition.wakeAll();
+
+    return id;
+}
+
+void CommandScheduler::cancel(quint64 id, qint64 deadline)
+{
+    this->timers.remove(id);
+
+    if (this->batchedDeadlines.removeAll(qMakePair(deadline, id)) > 0)
+        return;
+
+    QMutexLocker locker(&this->mutex);
+    this->deadlines.remove(deadline, id);
+}
+
+void CommandScheduler::beginBatch()
+{
+    if (this->batchDepth++ == 0)
+        this->batchTime = getTime();
+}
+
+void CommandScheduler::endBatch()
+{
+    if (this->batchDepth == 0 || --this->batchDepth > 0)
+        return;
+
+    if (this->batchedDeadlines.isEmpty())
+        return;
+
+    // Handed over at once so the worker never sees only a part of the batch.
+    QMutexLocker locker(&this->mutex);
+    for (int i = 0; i < this->batchedDeadlines.count(); i++)
+        this->deadlines.insert(this->batchedDeadlines.at(i).first, this->batchedDeadlines.at(i).second);
+
+    this->batchedDeadlines.clear();
+    this->condition.wakeAll();
+}
+
+void CommandScheduler::singleShot(int msec, QObject* receiver, const char* member)
+{
+    ScheduledTimer* timer = new ScheduledTimer(receiver);
+    timer->setSingleShot(true);
+    timer->setInterval(msec);
+
+    QObject::connect(timer, SIGNAL(timeout()), receiver, member);
+    QObject::connect(timer, SIGNAL(timeout()), timer, SLOT(deleteLater()));
+
+    timer->start();
+}
+
+void CommandScheduler::singleShot(int frames, double framesPerSecond, const QString& clock, QObject* receiver, const char* member)
+{
+    ScheduledTimer* timer = new ScheduledTimer(receiver);
+    timer->setSingleShot(true);
+    timer->setFrameInterval(frames, framesPerSecond, clock);
+
+    QObject::connect(timer, SIGNAL(timeout()), receiver, member);
+    QObject::connect(timer, SIGNAL(timeout()), timer, SLOT(deleteLater()));
+
+    timer->start();
+}
+
+qint64 CommandScheduler::getMaximumLateness() const
+{
+    return this->maximumLateness / 1000;
+}
+
+qint64 CommandScheduler::getAverageLateness() const
+{
+    if (this->firedCount == 0)
+        return 0;
+
+    return this->totalLateness / qint64(this->firedCount) / 1000;
+}
+
+qint64 CommandScheduler::getMaximumSkew() const
+{
+    return this->maximumSkew / 1000;
+}
+
+QString CommandScheduler::getFrameClock(const QString& deviceName, int channel)
+{
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(deviceName);
+    if (device == NULL)
+        return QString();
+
+    return StageStateManager::getChannelKey(device->resolveIpAddress(), channel);
+}
+
+void CommandScheduler::run()
+{
+    QMutexLocker locker(&this->mutex);
+    while (!this->stopped)
+    {
+        if (this->deadlines.isEmpty())
+        {
+            this->condition.wait(&this->mutex);
+            continue;
+        }
+
+        qint64 remaining = this->deadlines.firstKey() - getTime();
+        if (remaining > SPIN_INTERVAL)
+        {
+            // Woken up early when a command with an earlier deadline is scheduled.
+            this->condition.wait(&this->mutex, (remaining - SPIN_INTERVAL) / 1000000);
+            continue;
+        }
+        else if (remaining > 0)
+        {
+            locker.unlock();
+            QThread::yieldCurrentThread();
+            locker.relock();
+
+            continue;
+        }
+
+        qint64 time = getTime();
+        while (!this->deadlines.isEmpty() && this->deadlines.firstKey() <= time)
+            this->dueTimers.append(this->deadlines.take(this->deadlines.firstKey()));
+
+        if (!this->dispatchScheduled)
+        {
+            this->dispatchScheduled = true;
+            QMetaObject::invokeMethod(this, "dispatch", Qt::QueuedConnection);
+        }
+    }
+}
+
+void CommandScheduler::dispatch()
+{
+    QList<quint64> ids;
+    {
+        QMutexLocker locker(&this->mutex);
+        ids.swap(this->dueTimers);
+        this->dispatchScheduled = false;
+    }
+
+    // Commands due together are sent to each server in a single write, mixer changes are committed at once.
+    bool grouped = (ids.count() > 1);
+    if (grouped)
+        DeviceManager::getInstance().beginGroup();
+
+    qint64 first = -1;
+    qint64 last = -1;
+    foreach (quint64 id, ids)
+    {
+        // The timer may have been stopped or deleted by a command fired before it.
+        ScheduledTimer* timer = this->timers.take(id);
+        if (timer == NULL)
+            continue;
+
+        qint64 lateness = getTime() - timer->deadline;
+        this->firedCount++;
+        this->totalLateness += lateness;
+        this->maximumLateness = qMax(this->maximumLateness, lateness);
+
+        if (lateness / 1000 > LATENESS_WARNING)
+            qDebug("Scheduled command fired %lld us late", lateness / 1000);
+
+        if (first < 0)
+            first = getTime();
+
+        timer->fire();
+
+        last = getTime();
+    }
+
+    if (grouped)
+    {
+        DeviceManager::getInstance().commitGroup();
+
+        if (first >= 0)
+        {
+            qint64 skew = last - first;
+            this->maximumSkew = qMax(this->maximumSkew, skew);
+
+            qDebug("Fired %d scheduled commands as a group, %lld us skew", ids.count(), skew / 1000);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMultiMap>
+#include <QtCore/QMutex>
+#include <QtCore/QPair>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+class ScheduledTimer;
+
+/*
+ * Single scheduling engine for delayed and duration bound commands. Deadlines
+ * are kept on a monotonic clock and watched by a high priority thread, which
+ * hands due timers to the GUI thread. Frame based deadlines are aligned to the
+ * time the last frame report of the server was received over OSC, which trails
+ * the frame boundary by the network latency, when they are available. Timers
+ * started within a batch share one start time and are handed over together,
+ * commands due at the same time are sent to each server as one atomic group.
+ */
+class CORE_EXPORT CommandScheduler : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit CommandScheduler();
+
+        static CommandScheduler& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        qint64 getTime() const;
+        qint64 getStartTime() const;
+        qint64 getFrameDeadline(qint64 start, int frames, double framesPerSecond, const QString& clock) const;
+        void updateFrameClock(const QString& clock, qint64 time);
+
+        quint64 schedule(ScheduledTimer* timer, qint64 deadline);
+        void cancel(quint64 id, qint64 deadline);
+
+        void beginBatch();
+        void endBatch();
+
+        void singleShot(int msec, QObject* receiver, const char* member);
+        void singleShot(int frames, double framesPerSecond, const QString& clock, QObject* receiver, const char* member);
+
+        qint64 getMaximumLateness() const;
+        qint64 getAverageLateness() const;
+        qint64 getMaximumSkew() const;
+
+        static QString getFrameClock(const QString& deviceName, int channel);
+
+    protected:
+        void run();
+
+    private:
+        QElapsedTimer elapsedTimer;
+        quint64 nextId;
+
+        // Owned by the GUI thread.
+        QHash<quint64, ScheduledTimer*> timers;
+        QHash<QString, qint64> frameClocks;
+        quint64 firedCount;
+        qint64 totalLateness;
+        qint64 maximumLateness;
+        qint64 maximumSkew;
+        int batchDepth;
+        qint64 batchTime;
+        QList<QPair<qint64, quint64>> batchedDeadlines;
+
+        QMutex mutex;
+        QWaitCondition condition;
+        QMultiMap<qint64, quint64> deadlines;
+        QList<quint64> dueTimers;
+        bool dispatchScheduled;
+        bool stopped;
+
+        Q_SLOT void dispatch();
+};
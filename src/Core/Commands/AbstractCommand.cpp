@@ -1,10 +1,15 @@
 #include "AbstractCommand.h"
 
+#include "AmcpDevice.h"
+#include "CasparDevice.h"
+
 #include <QtCore/QXmlStreamWriter>
 
 AbstractCommand::AbstractCommand(QObject* parent)
     : QObject(parent)
 {
+    QObject::connect(this, SIGNAL(channelChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(videolayerChanged(int)), this, SLOT(invalidateAmcpMessages()));
 }
 
 AbstractCommand::~AbstractCommand()
@@ -55,48 +60,84 @@ void AbstractCommand::setChannel(int channel)
 {
     this->channel = channel;
     emit channelChanged(this->channel);
+    emit changed();
 }
 
 void AbstractCommand::setVideolayer(int videolayer)
 {
     this->videolayer = videolayer;
     emit videolayerChanged(this->videolayer);
+    emit changed();
 }
 
 void AbstractCommand::setDelay(int delay)
 {
     this->delay = delay;
     emit delayChanged(this->delay);
+    emit changed();
 }
 
 void AbstractCommand::setDuration(int duration)
 {
     this->duration = duration;
     emit durationChanged(this->duration);
+    emit changed();
 }
 
 void AbstractCommand::setAllowGpi(bool allowGpi)
 {
     this->allowGpi = allowGpi;
     emit allowGpiChanged(this->allowGpi);
+    emit changed();
 }
 
 void AbstractCommand::setAllowRemoteTriggering(bool allowRemoteTriggering)
 {
     this->allowRemoteTriggering = allowRemoteTriggering;
     emit allowRemoteTriggeringChanged(this->allowRemoteTriggering);
+    emit changed();
 }
 
 void AbstractCommand::setRemoteTriggerId(const QString& remoteTriggerId)
 {
     this->remoteTriggerId = remoteTriggerId;
     emit remoteTriggerIdChanged(this->remoteTriggerId);
+    emit changed();
 }
 
 void AbstractCommand::setStoryId(const QString& storyId)
 {
     this->storyId = storyId;
     emit storyIdChanged(this->storyId);
+    emit changed();
+}
+
+const QByteArray& AbstractCommand::getAmcpMessage(AmcpMessage message) const
+{
+    // Compiled on first use and kept until the command is edited, a take only looks the bytes up.
+    QHash<int, QByteArray>::iterator iterator = this->amcpMessages.find(static_cast<int>(message));
+    if (iterator == this->amcpMessages.end())
+        iterator = this->amcpMessages.insert(static_cast<int>(message), AmcpDevice::encodeMessage(compileAmcpMessage(message)));
+
+    return iterator.value();
+}
+
+QString AbstractCommand::compileAmcpMessage(AmcpMessage message) const
+{
+    switch (message)
+    {
+        case AmcpMessage::PlayLoaded:
+            return CasparDevice::getPlayMessage(this->channel, this->videolayer);
+        case AmcpMessage::Stop:
+            return CasparDevice::getStopMessage(this->channel, this->videolayer);
+        default:
+            return QString();
+    }
+}
+
+void AbstractCommand::invalidateAmcpMessages()
+{
+    this->amcpMessages.clear();
 }
 
 void AbstractCommand::readProperties(boost::property_tree::wptree& pt)
@@ -9,6 +9,8 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
 #include <QtCore/QObject>
 
 class QXmlStreamWriter;
@@ -18,6 +20,15 @@ class CORE_EXPORT AbstractCommand : public QObject, public AbstractProperties
     Q_OBJECT
 
     public:
+        enum class AmcpMessage
+        {
+            Play,
+            PlayLoaded,
+            Load,
+            Next,
+            Stop
+        };
+
         virtual ~AbstractCommand();
 
         virtual int getDelay() const;
@@ -41,9 +52,18 @@ class CORE_EXPORT AbstractCommand : public QObject, public AbstractProperties
         virtual void readProperties(boost::property_tree::wptree& pt);
         virtual void writeProperties(QXmlStreamWriter* writer);
 
+        const QByteArray& getAmcpMessage(AmcpMessage message) const;
+
+        // Emitted by every setter, i.e. whenever a property saved with the rundown is edited.
+        Q_SIGNAL void changed();
+
     protected:
         explicit AbstractCommand(QObject* parent = 0);
 
+        virtual QString compileAmcpMessage(AmcpMessage message) const;
+
+        Q_SLOT void invalidateAmcpMessages();
+
         QString storyId = "";
         QString remoteTriggerId = Output::DEFAULT_REMOTE_TRIGGER_ID;
 
@@ -56,6 +76,8 @@ class CORE_EXPORT AbstractCommand : public QObject, public AbstractProperties
 
 
     private:
+        mutable QHash<int, QByteArray> amcpMessages;
+
         Q_SIGNAL void channelChanged(int);
         Q_SIGNAL void videolayerChanged(int);
         Q_SIGNAL void delayChanged(int);
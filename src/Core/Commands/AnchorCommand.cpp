@@ -41,36 +41,42 @@ void AnchorCommand::setPositionX(float positionX)
 {
     this->positionX = positionX;
     emit positionXChanged(this->positionX);
+    emit changed();
 }
 
 void AnchorCommand::setPositionY(float positionY)
 {
     this->positionY = positionY;
     emit positionYChanged(this->positionY);
+    emit changed();
 }
 
 void AnchorCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void AnchorCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void AnchorCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AnchorCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void AnchorCommand::readProperties(boost::property_tree::wptree& pt)
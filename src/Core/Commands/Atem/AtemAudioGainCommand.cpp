@@ -26,18 +26,21 @@ void AtemAudioGainCommand::setInput(const QString& input)
 {
     this->input = input;
     emit inputChanged(this->input);
+    emit changed();
 }
 
 void AtemAudioGainCommand::setGain(float gain)
 {
     this->gain = gain;
     emit gainChanged(this->gain);
+    emit changed();
 }
 
 void AtemAudioGainCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemAudioGainCommand::readProperties(boost::property_tree::wptree& pt)
@@ -26,18 +26,21 @@ void AtemAudioInputBalanceCommand::setInput(const QString& input)
 {
     this->input = input;
     emit inputChanged(this->input);
+    emit changed();
 }
 
 void AtemAudioInputBalanceCommand::setBalance(float balance)
 {
     this->balance = balance;
     emit balanceChanged(this->balance);
+    emit changed();
 }
 
 void AtemAudioInputBalanceCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemAudioInputBalanceCommand::readProperties(boost::property_tree::wptree& pt)
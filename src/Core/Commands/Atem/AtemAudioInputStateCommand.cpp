@@ -26,18 +26,21 @@ void AtemAudioInputStateCommand::setInput(const QString& input)
 {
     this->input = input;
     emit inputChanged(this->input);
+    emit changed();
 }
 
 void AtemAudioInputStateCommand::setState(const QString& state)
 {
     this->state = state;
     emit stateChanged(this->state);
+    emit changed();
 }
 
 void AtemAudioInputStateCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemAudioInputStateCommand::readProperties(boost::property_tree::wptree& pt)
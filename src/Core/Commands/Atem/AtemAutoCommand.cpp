@@ -36,30 +36,35 @@ void AtemAutoCommand::setStep(const QString& step)
 {
     this->step = step;
     emit stepChanged(this->step);
+    emit changed();
 }
 
 void AtemAutoCommand::setSpeed(double speed)
 {
     this->speed = speed;
     emit speedChanged(this->speed);
+    emit changed();
 }
 
 void AtemAutoCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void AtemAutoCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemAutoCommand::setMixerStep(const QString& mixerStep)
 {
     this->mixerStep = mixerStep;
     emit mixerStepChanged(this->mixerStep);
+    emit changed();
 }
 
 void AtemAutoCommand::readProperties(boost::property_tree::wptree& pt)
@@ -27,18 +27,21 @@ void AtemCutCommand::setStep(const QString& step)
 {
     this->step = step;
     emit stepChanged(this->step);
+    emit changed();
 }
 
 void AtemCutCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemCutCommand::setMixerStep(const QString& mixerStep)
 {
     this->mixerStep = mixerStep;
     emit mixerStepChanged(this->mixerStep);
+    emit changed();
 }
 
 void AtemCutCommand::readProperties(boost::property_tree::wptree& pt)
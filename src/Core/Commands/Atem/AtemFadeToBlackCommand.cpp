@@ -26,18 +26,21 @@ void AtemFadeToBlackCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemFadeToBlackCommand::setMixerStep(const QString& mixerStep)
 {
     this->mixerStep = mixerStep;
     emit mixerStepChanged(this->mixerStep);
+    emit changed();
 }
 
 void AtemFadeToBlackCommand::setSpeed(double speed)
 {
     this->speed = speed;
     emit speedChanged(this->speed);
+    emit changed();
 }
 
 void AtemFadeToBlackCommand::readProperties(boost::property_tree::wptree& pt)
@@ -31,24 +31,28 @@ void AtemInputCommand::setSwitcher(const QString& switcher)
 {
     this->switcher = switcher;
     emit switcherChanged(this->switcher);
+    emit changed();
 }
 
 void AtemInputCommand::setInput(const QString& input)
 {
     this->input = input;
     emit inputChanged(this->input);
+    emit changed();
 }
 
 void AtemInputCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemInputCommand::setMixerStep(const QString& mixerStep)
 {
     this->mixerStep = mixerStep;
     emit mixerStepChanged(this->mixerStep);
+    emit changed();
 }
 
 void AtemInputCommand::readProperties(boost::property_tree::wptree& pt)
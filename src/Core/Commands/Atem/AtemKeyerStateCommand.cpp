@@ -31,24 +31,28 @@ void AtemKeyerStateCommand::setKeyer(const QString& keyer)
 {
     this->keyer = keyer;
     emit keyerChanged(this->keyer);
+    emit changed();
 }
 
 void AtemKeyerStateCommand::setState(bool state)
 {
     this->state = state;
     emit stateChanged(this->state);
+    emit changed();
 }
 
 void AtemKeyerStateCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemKeyerStateCommand::setMixerStep(const QString& mixerStep)
 {
     this->mixerStep = mixerStep;
     emit mixerStepChanged(this->mixerStep);
+    emit changed();
 }
 
 void AtemKeyerStateCommand::readProperties(boost::property_tree::wptree& pt)
@@ -21,12 +21,14 @@ void AtemMacroCommand::setMacro(const QString& macro)
 {
     this->macro = macro;
     emit macroChanged(this->macro);
+    emit changed();
 }
 
 void AtemMacroCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemMacroCommand::readProperties(boost::property_tree::wptree& pt)
@@ -21,12 +21,14 @@ void AtemVideoFormatCommand::setFormat(const QString& format)
 {
     this->format = format;
     emit formatChanged(this->format);
+    emit changed();
 }
 
 void AtemVideoFormatCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AtemVideoFormatCommand::readProperties(boost::property_tree::wptree& pt)
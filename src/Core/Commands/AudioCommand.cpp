@@ -1,11 +1,21 @@
 #include "AudioCommand.h"
 
+#include "CasparDevice.h"
+
 #include <QtCore/QXmlStreamWriter>
 
 AudioCommand::AudioCommand(QObject* parent)
     : AbstractCommand(parent)
 {
     this->videolayer = Output::DEFAULT_AUDIO_VIDEOLAYER;
+
+    QObject::connect(this, SIGNAL(audioNameChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionDurationChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(directionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(tweenChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(loopChanged(bool)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(useAutoChanged(bool)), this, SLOT(invalidateAmcpMessages()));
 }
 
 const QString& AudioCommand::getAudioName() const
@@ -52,48 +62,71 @@ void AudioCommand::setAudioName(const QString& audioName)
 {
     this->audioName = audioName;
     emit audioNameChanged(this->audioName);
+    emit changed();
 }
 
 void AudioCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void AudioCommand::setTransitionDuration(int transitionDuration)
 {
     this->transitionDuration = transitionDuration;
     emit transitionDurationChanged(this->transitionDuration);
+    emit changed();
 }
 
 void AudioCommand::setDirection(const QString& direction)
 {
     this->direction = direction;
     emit directionChanged(this->direction);
+    emit changed();
 }
 
 void AudioCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void AudioCommand::setLoop(bool loop)
 {
     this->loop = loop;
     emit loopChanged(this->loop);
+    emit changed();
 }
 
 void AudioCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AudioCommand::setUseAuto(bool useAuto)
 {
     this->useAuto = useAuto;
     emit useAutoChanged(this->useAuto);
+    emit changed();
+}
+
+QString AudioCommand::compileAmcpMessage(AmcpMessage message) const
+{
+    switch (message)
+    {
+        case AmcpMessage::Play:
+            return CasparDevice::getPlayAudioMessage(this->channel, this->videolayer, this->audioName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->loop, this->useAuto);
+        case AmcpMessage::Load:
+            return CasparDevice::getLoadAudioMessage(this->channel, this->videolayer, this->audioName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->loop, this->useAuto);
+        default:
+            return AbstractCommand::compileAmcpMessage(message);
+    }
 }
 
 void AudioCommand::readProperties(boost::property_tree::wptree& pt)
@@ -42,6 +42,9 @@ class CORE_EXPORT AudioCommand : public AbstractCommand
         void setLoop(bool loop);
         void setUseAuto(bool useAuto);
 
+    protected:
+        virtual QString compileAmcpMessage(AmcpMessage message) const;
+
     private:
         QString audioName = Audio::DEFAULT_NAME;
         QString transition = Mixer::DEFAULT_TRANSITION;
@@ -16,6 +16,7 @@ void BlendModeCommand::setBlendMode(const QString& blendMode)
 {
     this->blendMode = blendMode;
     emit blendModeChanged(this->blendMode);
+    emit changed();
 }
 
 void BlendModeCommand::readProperties(boost::property_tree::wptree& pt)
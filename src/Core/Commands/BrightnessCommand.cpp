@@ -31,24 +31,28 @@ void BrightnessCommand::setBrightness(float brightness)
 {
     this->brightness = brightness;
     emit brightnessChanged(this->brightness);
+    emit changed();
 }
 
 void BrightnessCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void BrightnessCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void BrightnessCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void BrightnessCommand::readProperties(boost::property_tree::wptree& pt)
@@ -31,24 +31,28 @@ void ChromaCommand::setKey(const QString& chromaKey)
 {
     this->key = chromaKey;
     emit keyChanged(this->key);
+    emit changed();
 }
 
 void ChromaCommand::setSpread(float stop)
 {
     this->spread = stop;
     emit spreadChanged(this->spread);
+    emit changed();
 }
 
 void ChromaCommand::setSpill(float spill)
 {
     this->spill = spill;
     emit spillChanged(this->spill);
+    emit changed();
 }
 
 void ChromaCommand::setThreshold(float start)
 {
     this->threshold = start;
     emit thresholdChanged(this->threshold);
+    emit changed();
 }
 
 void ChromaCommand::readProperties(boost::property_tree::wptree& pt)
@@ -46,42 +46,49 @@ void ClipCommand::setLeft(float left)
 {
     this->left = left;
     emit leftChanged(this->left);
+    emit changed();
 }
 
 void ClipCommand::setWidth(float width)
 {
     this->width = width;
     emit widthChanged(this->width);
+    emit changed();
 }
 
 void ClipCommand::setTop(float top)
 {
     this->top = top;
     emit topChanged(this->top);
+    emit changed();
 }
 
 void ClipCommand::setHeight(float height)
 {
     this->height = height;
     emit heightChanged(this->height);
+    emit changed();
 }
 
 void ClipCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void ClipCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void ClipCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void ClipCommand::readProperties(boost::property_tree::wptree& pt)
@@ -31,24 +31,28 @@ void ContrastCommand::setContrast(float contrast)
 {
     this->contrast = contrast;
     emit contrastChanged(this->contrast);
+    emit changed();
 }
 
 void ContrastCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void ContrastCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void ContrastCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void ContrastCommand::readProperties(boost::property_tree::wptree& pt)
@@ -46,42 +46,49 @@ void CropCommand::setLeft(float left)
 {
     this->left = left;
     emit leftChanged(this->left);
+    emit changed();
 }
 
 void CropCommand::setTop(float top)
 {
     this->top = top;
     emit topChanged(this->top);
+    emit changed();
 }
 
 void CropCommand::setRight(float right)
 {
     this->right = right;
     emit rightChanged(this->right);
+    emit changed();
 }
 
 void CropCommand::setBottom(float bottom)
 {
     this->bottom = bottom;
     emit bottomChanged(this->bottom);
+    emit changed();
 }
 
 void CropCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void CropCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void CropCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void CropCommand::readProperties(boost::property_tree::wptree& pt)
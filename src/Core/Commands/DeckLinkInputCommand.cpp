@@ -41,36 +41,42 @@ void DeckLinkInputCommand::setDevice(int device)
 {
     this->device = device;
     emit deviceChanged(this->device);
+    emit changed();
 }
 
 void DeckLinkInputCommand::setFormat(const QString& format)
 {
     this->format = format;
     emit formatChanged(this->format);
+    emit changed();
 }
 
 void DeckLinkInputCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void DeckLinkInputCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void DeckLinkInputCommand::setDirection(const QString& direction)
 {
     this->direction = direction;
     emit directionChanged(this->direction);
+    emit changed();
 }
 
 void DeckLinkInputCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void DeckLinkInputCommand::readProperties(boost::property_tree::wptree& pt)
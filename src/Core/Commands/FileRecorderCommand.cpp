@@ -36,30 +36,35 @@ void FileRecorderCommand::setOutput(const QString& output)
 {
     this->output = output;
     emit outputChanged(this->output);
+    emit changed();
 }
 
 void FileRecorderCommand::setCodec(const QString& codec)
 {
     this->codec = codec;
     emit codecChanged(this->codec);
+    emit changed();
 }
 
 void FileRecorderCommand::setPreset(const QString& preset)
 {
     this->preset = preset;
     emit presetChanged(this->preset);
+    emit changed();
 }
 
 void FileRecorderCommand::setTune(const QString& tune)
 {
     this->tune = tune;
     emit tuneChanged(this->tune);
+    emit changed();
 }
 
 void FileRecorderCommand::setWithAlpha(bool withAlpha)
 {
     this->withAlpha = withAlpha;
     emit withAlphaChanged(this->withAlpha);
+    emit changed();
 }
 
 void FileRecorderCommand::readProperties(boost::property_tree::wptree& pt)
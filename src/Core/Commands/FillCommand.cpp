@@ -56,54 +56,63 @@ void FillCommand::setPositionX(float positionX)
 {
     this->positionX = positionX;
     emit positionXChanged(this->positionX);
+    emit changed();
 }
 
 void FillCommand::setPositionY(float positionY)
 {
     this->positionY = positionY;
     emit positionYChanged(this->positionY);
+    emit changed();
 }
 
 void FillCommand::setScaleX(float scaleX)
 {
     this->scaleX = scaleX;
     emit scaleXChanged(this->scaleX);
+    emit changed();
 }
 
 void FillCommand::setScaleY(float scaleY)
 {
     this->scaleY = scaleY;
     emit scaleYChanged(this->scaleY);
+    emit changed();
 }
 
 void FillCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void FillCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void FillCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void FillCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void FillCommand::setUseMipmap(bool useMipmap)
 {
     this->useMipmap = useMipmap;
     emit useMipmapChanged(this->useMipmap);
+    emit changed();
 }
 
 void FillCommand::readProperties(boost::property_tree::wptree& pt)
@@ -31,24 +31,28 @@ void GridCommand::setGrid(int grid)
 {
     this->grid = grid;
     emit gridChanged(this->grid);
+    emit changed();
 }
 
 void GridCommand::setTransitionDuration(int transitionDuration)
 {
     this->transitionDuration = transitionDuration;
     emit transitionDurationChanged(this->transitionDuration);
+    emit changed();
 }
 
 void GridCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void GridCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void GridCommand::readProperties(boost::property_tree::wptree& pt)
@@ -26,18 +26,21 @@ void GroupCommand::setAutoStep(bool autoStep)
 {
     this->autoStep = autoStep;
     emit autoStepChanged(this->autoStep);
+    emit changed();
 }
 
 void GroupCommand::setAutoPlay(bool autoPlay)
 {
     this->autoPlay = autoPlay;
     emit autoPlayChanged(this->autoPlay);
+    emit changed();
 }
 
 void GroupCommand::setNotes(const QString& notes)
 {
     this->notes = notes;
     emit notesChanged(this->notes);
+    emit changed();
 }
 
 void GroupCommand::readProperties(boost::property_tree::wptree& pt)
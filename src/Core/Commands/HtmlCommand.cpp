@@ -51,48 +51,56 @@ void HtmlCommand::setUrl(const QString& url)
 {
     this->url = url;
     emit urlChanged(this->url);
+    emit changed();
 }
 
 void HtmlCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void HtmlCommand::setTransitionDuration(int transitionDuration)
 {
     this->transitionDuration = transitionDuration;
     emit transitionDurationChanged(this->transitionDuration);
+    emit changed();
 }
 
 void HtmlCommand::setDirection(const QString& direction)
 {
     this->direction = direction;
     emit directionChanged(this->direction);
+    emit changed();
 }
 
 void HtmlCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void HtmlCommand::setFreezeOnLoad(bool freezeOnLoad)
 {
     this->freezeOnLoad = freezeOnLoad;
     emit freezeOnLoadChanged(this->freezeOnLoad);
+    emit changed();
 }
 
 void HtmlCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void HtmlCommand::setUseAuto(bool useAuto)
 {
     this->useAuto = useAuto;
     emit useAutoChanged(this->useAuto);
+    emit changed();
 }
 
 void HtmlCommand::readProperties(boost::property_tree::wptree& pt)
@@ -36,18 +36,21 @@ void HttpGetCommand::setUrl(const QString& url)
 {
     this->url = url;
     emit urlChanged(this->url);
+    emit changed();
 }
 
 void HttpGetCommand::setHttpDataModels(const QList<KeyValueModel>& models)
 {
     this->models = models;
     emit httpDataChanged(this->models);
+    emit changed();
 }
 
 void HttpGetCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void HttpGetCommand::readProperties(boost::property_tree::wptree& pt)
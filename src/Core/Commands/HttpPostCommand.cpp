@@ -36,18 +36,21 @@ void HttpPostCommand::setUrl(const QString& url)
 {
     this->url = url;
     emit urlChanged(this->url);
+    emit changed();
 }
 
 void HttpPostCommand::setHttpDataModels(const QList<KeyValueModel>& models)
 {
     this->models = models;
     emit httpDataChanged(this->models);
+    emit changed();
 }
 
 void HttpPostCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void HttpPostCommand::readProperties(boost::property_tree::wptree& pt)
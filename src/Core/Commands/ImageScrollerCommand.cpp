@@ -36,30 +36,35 @@ void ImageScrollerCommand::setImageScrollerName(const QString& imageScrollerName
 {
     this->imageScrollerName = imageScrollerName;
     emit imageScrollerNameChanged(this->imageScrollerName);
+    emit changed();
 }
 
 void ImageScrollerCommand::setBlur(int blur)
 {
     this->blur = blur;
     emit blurChanged(this->blur);
+    emit changed();
 }
 
 void ImageScrollerCommand::setSpeed(int speed)
 {
     this->speed = speed;
     emit speedChanged(this->speed);
+    emit changed();
 }
 
 void ImageScrollerCommand::setPremultiply(bool premultiply)
 {
     this->premultiply = premultiply;
     emit premultiplyChanged(this->premultiply);
+    emit changed();
 }
 
 void ImageScrollerCommand::setProgressive(bool progressive)
 {
     this->progressive = progressive;
     emit progressiveChanged(this->progressive);
+    emit changed();
 }
 
 void ImageScrollerCommand::readProperties(boost::property_tree::wptree& pt)
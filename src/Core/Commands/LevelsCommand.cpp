@@ -51,48 +51,56 @@ void LevelsCommand::setMinIn(float minIn)
 {
     this->minIn = minIn;
     emit minInChanged(this->minIn);
+    emit changed();
 }
 
 void LevelsCommand::setMaxIn(float maxIn)
 {
     this->maxIn = maxIn;
     emit maxInChanged(this->maxIn);
+    emit changed();
 }
 
 void LevelsCommand::setMinOut(float minOut)
 {
     this->minOut = minOut;
     emit minOutChanged(this->minOut);
+    emit changed();
 }
 
 void LevelsCommand::setMaxOut(float maxOut)
 {
     this->maxOut = maxOut;
     emit maxOutChanged(this->maxOut);
+    emit changed();
 }
 
 void LevelsCommand::setGamma(float gamma)
 {
     this->gamma = gamma;
     emit gammaChanged(this->gamma);
+    emit changed();
 }
 
 void LevelsCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void LevelsCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void LevelsCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void LevelsCommand::readProperties(boost::property_tree::wptree& pt)
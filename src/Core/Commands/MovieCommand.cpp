@@ -1,10 +1,22 @@
 #include "MovieCommand.h"
 
+#include "CasparDevice.h"
+
 #include <QtCore/QXmlStreamWriter>
 
 MovieCommand::MovieCommand(QObject* parent)
     : AbstractCommand(parent)
 {
+    QObject::connect(this, SIGNAL(videoNameChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionDurationChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(directionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(tweenChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(loopChanged(bool)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(freezeOnLoadChanged(bool)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(seekChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(lengthChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(autoPlayChanged(bool)), this, SLOT(invalidateAmcpMessages()));
 }
 
 const QString& MovieCommand::getVideoName() const
@@ -66,66 +78,95 @@ void MovieCommand::setVideoName(const QString& videoName)
 {
     this->videoName = videoName;
     emit videoNameChanged(this->videoName);
+    emit changed();
 }
 
 void MovieCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void MovieCommand::setTransitionDuration(int transitionDuration)
 {
     this->transitionDuration = transitionDuration;
     emit transitionDurationChanged(this->transitionDuration);
+    emit changed();
 }
 
 void MovieCommand::setDirection(const QString& direction)
 {
     this->direction = direction;
     emit directionChanged(this->direction);
+    emit changed();
 }
 
 void MovieCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void MovieCommand::setLoop(bool loop)
 {
     this->loop = loop;
     emit loopChanged(this->loop);
+    emit changed();
 }
 
 void MovieCommand::setFreezeOnLoad(bool freezeOnLoad)
 {
     this->freezeOnLoad = freezeOnLoad;
     emit freezeOnLoadChanged(this->freezeOnLoad);
+    emit changed();
 }
 
 void MovieCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void MovieCommand::setSeek(int seek)
 {
     this->seek = seek;
     emit seekChanged(this->seek);
+    emit changed();
 }
 
 void MovieCommand::setLength(int length)
 {
     this->length = length;
     emit lengthChanged(this->length);
+    emit changed();
 }
 
 void MovieCommand::setAutoPlay(bool autoPlay)
 {
     this->autoPlay = autoPlay;
     emit autoPlayChanged(this->autoPlay);
+    emit changed();
+}
+
+QString MovieCommand::compileAmcpMessage(AmcpMessage message) const
+{
+    switch (message)
+    {
+        case AmcpMessage::Play:
+            return CasparDevice::getPlayMovieMessage(this->channel, this->videolayer, this->videoName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->seek, this->length, this->loop, this->autoPlay);
+        case AmcpMessage::Next:
+            return CasparDevice::getPlayMovieMessage(this->channel, this->videolayer, this->videoName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->seek, this->length, this->loop, false);
+        case AmcpMessage::Load:
+            return CasparDevice::getLoadMovieMessage(this->channel, this->videolayer, this->videoName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->seek, this->length, this->loop, this->freezeOnLoad, false);
+        default:
+            return AbstractCommand::compileAmcpMessage(message);
+    }
 }
 
 void MovieCommand::readProperties(boost::property_tree::wptree& pt)
@@ -48,6 +48,9 @@ class CORE_EXPORT MovieCommand : public AbstractCommand
         void setLength(int length);
         void setAutoPlay(bool autoPlay);
 
+    protected:
+        virtual QString compileAmcpMessage(AmcpMessage message) const;
+
     private:
         QString videoName = Movie::DEFAULT_NAME;
         QString transition = Mixer::DEFAULT_TRANSITION;
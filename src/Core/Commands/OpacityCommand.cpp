@@ -36,30 +36,35 @@ void OpacityCommand::setOpacity(float opacity)
 {
     this->opacity = opacity;
     emit opacityChanged(this->opacity);
+    emit changed();
 }
 
 void OpacityCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void OpacityCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void OpacityCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void OpacityCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void OpacityCommand::readProperties(boost::property_tree::wptree& pt)
@@ -26,18 +26,21 @@ void PanasonicPresetCommand::setAddress(const QString& address)
 {
     this->address = address;
     emit addressChanged(this->address);
+    emit changed();
 }
 
 void PanasonicPresetCommand::setPreset(int preset)
 {
     this->preset = preset;
     emit presetChanged(this->preset);
+    emit changed();
 }
 
 void PanasonicPresetCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void PanasonicPresetCommand::readProperties(boost::property_tree::wptree& pt)
@@ -76,78 +76,91 @@ void PerspectiveCommand::setUpperLeftX(float upperLeftX)
 {
     this->upperLeftX = upperLeftX;
     emit upperLeftXChanged(this->upperLeftX);
+    emit changed();
 }
 
 void PerspectiveCommand::setUpperLeftY(float upperLeftY)
 {
     this->upperLeftY = upperLeftY;
     emit upperLeftYChanged(this->upperLeftY);
+    emit changed();
 }
 
 void PerspectiveCommand::setUpperRightX(float upperRightX)
 {
     this->upperRightX = upperRightX;
     emit upperRightXChanged(this->upperRightX);
+    emit changed();
 }
 
 void PerspectiveCommand::setUpperRightY(float upperRightY)
 {
     this->upperRightY = upperRightY;
     emit upperRightYChanged(this->upperRightY);
+    emit changed();
 }
 
 void PerspectiveCommand::setLowerRightX(float lowerRightX)
 {
     this->lowerRightX = lowerRightX;
     emit lowerRightXChanged(this->lowerRightX);
+    emit changed();
 }
 
 void PerspectiveCommand::setLowerRightY(float lowerRightY)
 {
     this->lowerRightY = lowerRightY;
     emit lowerRightYChanged(this->lowerRightY);
+    emit changed();
 }
 
 void PerspectiveCommand::setLowerLeftX(float lowerLeftX)
 {
     this->lowerLeftX = lowerLeftX;
     emit lowerLeftXChanged(this->lowerLeftX);
+    emit changed();
 }
 
 void PerspectiveCommand::setLowerLeftY(float lowerLeftY)
 {
     this->lowerLeftY = lowerLeftY;
     emit lowerLeftYChanged(this->lowerLeftY);
+    emit changed();
 }
 
 void PerspectiveCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void PerspectiveCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void PerspectiveCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void PerspectiveCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void PerspectiveCommand::setUseMipmap(bool useMipmap)
 {
     this->useMipmap = useMipmap;
     emit useMipmapChanged(this->useMipmap);
+    emit changed();
 }
 
 void PerspectiveCommand::readProperties(boost::property_tree::wptree& pt)
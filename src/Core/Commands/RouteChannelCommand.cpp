@@ -16,6 +16,7 @@ void RouteChannelCommand::setFromChannel(int fromChannel)
 {
     this->fromChannel = fromChannel;
     emit fromChannelChanged(this->fromChannel);
+    emit changed();
 }
 
 void RouteChannelCommand::readProperties(boost::property_tree::wptree& pt)
@@ -21,12 +21,14 @@ void RouteVideolayerCommand::setFromChannel(int fromChannel)
 {
     this->fromChannel = fromChannel;
     emit fromChannelChanged(this->fromChannel);
+    emit changed();
 }
 
 void RouteVideolayerCommand::setFromVideolayer(int fromVideolayer)
 {
     this->fromVideolayer = fromVideolayer;
     emit fromVideolayerChanged(this->fromVideolayer);
+    emit changed();
 }
 
 void RouteVideolayerCommand::readProperties(boost::property_tree::wptree& pt)
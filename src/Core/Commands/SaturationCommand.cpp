@@ -31,24 +31,28 @@ void SaturationCommand::setSaturation(float saturation)
 {
     this->saturation = saturation;
     emit saturationChanged(this->saturation);
+    emit changed();
 }
 
 void SaturationCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void SaturationCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void SaturationCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void SaturationCommand::readProperties(boost::property_tree::wptree& pt)
@@ -26,18 +26,21 @@ void SonyPresetCommand::setAddress(const QString& address)
 {
     this->address = address;
     emit addressChanged(this->address);
+    emit changed();
 }
 
 void SonyPresetCommand::setPreset(int preset)
 {
     this->preset = preset;
     emit presetChanged(this->preset);
+    emit changed();
 }
 
 void SonyPresetCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void SonyPresetCommand::readProperties(boost::property_tree::wptree& pt)
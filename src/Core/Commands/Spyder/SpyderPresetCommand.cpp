@@ -26,18 +26,21 @@ void SpyderPresetCommand::setAddress(const QString& address)
 {
     this->address = address;
     emit addressChanged(this->address);
+    emit changed();
 }
 
 void SpyderPresetCommand::setPreset(int preset)
 {
     this->preset = preset;
     emit presetChanged(this->preset);
+    emit changed();
 }
 
 void SpyderPresetCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void SpyderPresetCommand::readProperties(boost::property_tree::wptree& pt)
@@ -1,10 +1,18 @@
 #include "StillCommand.h"
 
+#include "CasparDevice.h"
+
 #include <QtCore/QXmlStreamWriter>
 
 StillCommand::StillCommand(QObject* parent)
     : AbstractCommand(parent)
 {
+    QObject::connect(this, SIGNAL(imageNameChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(transitionDurationChanged(int)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(directionChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(tweenChanged(const QString&)), this, SLOT(invalidateAmcpMessages()));
+    QObject::connect(this, SIGNAL(useAutoChanged(bool)), this, SLOT(invalidateAmcpMessages()));
 }
 
 const QString& StillCommand::getImageName() const
@@ -46,42 +54,64 @@ void StillCommand::setImageName(const QString& imageName)
 {
     this->imageName = imageName;
     emit imageNameChanged(this->imageName);
+    emit changed();
 }
 
 void StillCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void StillCommand::setTransitionDuration(int transitionDuration)
 {
     this->transitionDuration = transitionDuration;
     emit transitionDurationChanged(this->transitionDuration);
+    emit changed();
 }
 
 void StillCommand::setDirection(const QString& direction)
 {
     this->direction = direction;
     emit directionChanged(this->direction);
+    emit changed();
 }
 
 void StillCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void StillCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void StillCommand::setUseAuto(bool useAuto)
 {
     this->useAuto = useAuto;
     emit useAutoChanged(this->useAuto);
+    emit changed();
+}
+
+QString StillCommand::compileAmcpMessage(AmcpMessage message) const
+{
+    switch (message)
+    {
+        case AmcpMessage::Play:
+            return CasparDevice::getPlayStillMessage(this->channel, this->videolayer, this->imageName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->useAuto);
+        case AmcpMessage::Load:
+            return CasparDevice::getLoadStillMessage(this->channel, this->videolayer, this->imageName, this->transition, this->transitionDuration,
+                                                     this->tween, this->direction, this->useAuto);
+        default:
+            return AbstractCommand::compileAmcpMessage(message);
+    }
 }
 
 void StillCommand::readProperties(boost::property_tree::wptree& pt)
@@ -40,6 +40,9 @@ class CORE_EXPORT StillCommand : public AbstractCommand
         void setTriggerOnNext(bool triggerOnNext);
         void setUseAuto(bool useAuto);
 
+    protected:
+        virtual QString compileAmcpMessage(AmcpMessage message) const;
+
     private:
         QString imageName = Still::DEFAULT_NAME;
         QString transition = Mixer::DEFAULT_TRANSITION;
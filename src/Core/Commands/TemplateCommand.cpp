@@ -1,6 +1,6 @@
 #include "TemplateCommand.h"
 
-#include "Xml.h"
+#include "LiveDataManager.h"
 
 #include <QtCore/QXmlStreamWriter>
 
@@ -8,6 +8,8 @@ TemplateCommand::TemplateCommand(QObject* parent)
     : AbstractCommand(parent)
 {
     this->videolayer = Output::DEFAULT_FLASH_VIDEOLAYER;
+
+    QObject::connect(&LiveDataManager::getInstance(), SIGNAL(valuesChanged(const QStringList&)), this, SLOT(liveDataValuesChanged(const QStringList&)));
 }
 
 int TemplateCommand::getFlashlayer() const
@@ -40,48 +42,148 @@ const QString& TemplateCommand::getTemplateName() const
     return this->templateName;
 }
 
-const QString TemplateCommand::getTemplateData() const
+const QString& TemplateCommand::getTemplateData() const
 {
-    QString templateData;
+    if (!this->templateData.isNull())
+        return this->templateData;
+
     if (this->useStoredData)
     {
-        if (this->models.count() == 0)
-            return "";
+        this->templateData = (this->models.count() > 0) ? this->models.at(0).getValue() : QString("");
 
-        templateData.append(this->models.at(0).getValue());
+        return this->templateData;
     }
-    else
+
+    // Only components edited since the last take are encoded again.
+    int size = 0;
+    for (int i = 0; i < this->models.count(); i++)
     {
-        if (this->sendAsJson)
+        if (this->componentData.at(i).isNull())
+            this->componentData[i] = encodeComponentData(this->models.at(i));
+
+        size += this->componentData.at(i).size() + 1;
+    }
+
+    QString templateData;
+    templateData.reserve(size + 32);
+
+    if (this->sendAsJson)
+    {
+        templateData.append("{");
+        for (int i = 0; i < this->componentData.count(); i++)
         {
-            templateData.append("{");
-            foreach (KeyValueModel model, this->models)
-            {
-                templateData.append(QString("\\\"%1\\\":\\\"%2\\\",").arg(model.getKey())
-                                                                     .arg((this->useUppercaseData == true) ? model.getValue().toUpper() : model.getValue()));
-            }
-            templateData.chop(1);
-            templateData.append("}");
+            if (i > 0)
+                templateData.append(",");
+
+            templateData.append(this->componentData.at(i));
         }
-        else
+        templateData.append("}");
+    }
+    else
+    {
+        templateData.append("<templateData>");
+        foreach (const QString& componentData, this->componentData)
+            templateData.append(componentData);
+        templateData.append("</templateData>");
+    }
+
+    this->templateData = templateData;
+
+    return this->templateData;
+}
+
+QString TemplateCommand::encodeComponentData(const KeyValueModel& model) const
+{
+    // A value of {{key}} is bound to the live data of that key, it's sent as written until the key has a value.
+    const QString key = LiveDataManager::getBoundKey(model.getValue());
+    const QString data = (key.isEmpty() || !LiveDataManager::getInstance().contains(key)) ? model.getValue() : LiveDataManager::getInstance().getValue(key);
+    const QString value = (this->useUppercaseData == true) ? data.toUpper() : data;
+
+    QString componentData;
+    componentData.reserve(model.getKey().size() + value.size() + value.size() / 8 + 64);
+
+    if (this->sendAsJson)
+        componentData.append("\\\"").append(model.getKey()).append("\\\":\\\"");
+    else
+        componentData.append("<componentData id=\\\"").append(model.getKey()).append("\\\"><data id=\\\"text\\\" value=\\\"");
+
+    // Escaped for the template and for the quoted AMCP parameter in a single pass.
+    const QChar* characters = value.constData();
+    int start = 0;
+    for (int index = 0; index < value.size(); index++)
+    {
+        const char* escaped = NULL;
+        switch (characters[index].unicode())
         {
-            templateData.append("<templateData>");
-            foreach (KeyValueModel model, this->models)
-            {
-                QString componentData = TemplateData::DEFAULT_COMPONENT_DATA_XML;
-                componentData.replace("#KEY", model.getKey());
-
-                QString value = model.getValue();
-                value = Xml::encode(value).replace("\\", "\\\\");
-                componentData.replace("#VALUE", (this->useUppercaseData == true) ? value.toUpper() : value);
-
-                templateData.append(componentData);
-            }
-            templateData.append("</templateData>");
+            case '\\':
+                escaped = (this->sendAsJson == true) ? "\\\\\\\\" : "\\\\";
+                break;
+            case '"':
+                escaped = (this->sendAsJson == true) ? "\\\\\\\"" : "&quot;";
+                break;
+            case '&':
+                escaped = (this->sendAsJson == true) ? NULL : "&amp;";
+                break;
+            case '\'':
+                escaped = (this->sendAsJson == true) ? NULL : "&apos;";
+                break;
+            case '<':
+                escaped = (this->sendAsJson == true) ? NULL : "&lt;";
+                break;
+            case '>':
+                escaped = (this->sendAsJson == true) ? NULL : "&gt;";
+                break;
         }
+
+        if (escaped == NULL)
+            continue;
+
+        componentData.append(characters + start, index - start);
+        componentData.append(QLatin1String(escaped));
+        start = index + 1;
+    }
+    componentData.append(characters + start, value.size() - start);
+
+    if (this->sendAsJson)
+        componentData.append("\\\"");
+    else
+        componentData.append("\\\"/></componentData>");
+
+    return componentData;
+}
+
+void TemplateCommand::invalidateTemplateData(bool components)
+{
+    this->templateData = QString();
+
+    if (components)
+    {
+        this->componentData.clear();
+        for (int i = 0; i < this->models.count(); i++)
+            this->componentData.append(QString());
+    }
+}
+
+void TemplateCommand::liveDataValuesChanged(const QStringList& keys)
+{
+    // Only components bound to a key that changed are encoded again.
+    bool changed = false;
+    for (int i = 0; i < this->models.count() && i < this->componentData.count(); i++)
+    {
+        const QString key = LiveDataManager::getBoundKey(this->models.at(i).getValue());
+        if (key.isEmpty() || !keys.contains(key))
+            continue;
+
+        this->componentData[i] = QString();
+        changed = true;
     }
 
-    return templateData;
+    if (!changed)
+        return;
+
+    this->templateData = QString();
+
+    emit liveDataChanged();
 }
 
 const QList<KeyValueModel>& TemplateCommand::getTemplateDataModels() const
@@ -98,48 +200,73 @@ void TemplateCommand::setFlashlayer(int flashlayer)
 {
     this->flashlayer = flashlayer;
     emit flashlayerChanged(this->flashlayer);
+    emit changed();
 }
 
 void TemplateCommand::setInvoke(const QString& invoke)
 {
     this->invoke = invoke;
     emit invokeChanged(this->invoke);
+    emit changed();
 }
 
 void TemplateCommand::setUseStoredData(bool useStoredData)
 {
     this->useStoredData = useStoredData;
+    invalidateTemplateData(false);
     emit useStoredDataChanged(this->useStoredData);
+    emit changed();
 }
 
 void TemplateCommand::setSendAsJson(bool sendAsJson)
 {
     this->sendAsJson = sendAsJson;
+    invalidateTemplateData(true);
     emit sendAsJsonChanged(this->sendAsJson);
+    emit changed();
 }
 
 void TemplateCommand::setUseUppercaseData(bool useUppercaseData)
 {
     this->useUppercaseData = useUppercaseData;
+    invalidateTemplateData(true);
     emit useUppercaseDataChanged(this->useUppercaseData);
+    emit changed();
 }
 
 void TemplateCommand::setTemplateName(const QString& templateName)
 {
     this->templateName = templateName;
     emit templateNameChanged(this->templateName);
+    emit changed();
 }
 
 void TemplateCommand::setTemplateDataModels(const QList<KeyValueModel>& models)
 {
+    // Components that are unchanged keep their encoded data.
+    QList<QString> componentData;
+    for (int i = 0; i < models.count(); i++)
+    {
+        if (i < this->models.count() && i < this->componentData.count() &&
+            this->models.at(i).getKey() == models.at(i).getKey() && this->models.at(i).getValue() == models.at(i).getValue())
+            componentData.append(this->componentData.at(i));
+        else
+            componentData.append(QString());
+    }
+
     this->models = models;
+    this->componentData = componentData;
+    this->templateData = QString();
+
     emit templateDataChanged(this->models);
+    emit changed();
 }
 
 void TemplateCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void TemplateCommand::readProperties(boost::property_tree::wptree& pt)
@@ -161,6 +288,8 @@ void TemplateCommand::readProperties(boost::property_tree::wptree& pt)
                                                  QString::fromStdWString(value.second.get<std::wstring>(L"value"))));
         }
     }
+
+    invalidateTemplateData(true);
 }
 
 void TemplateCommand::writeProperties(QXmlStreamWriter* writer)
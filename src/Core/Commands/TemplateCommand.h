@@ -10,7 +10,9 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
+#include <QtCore/QList>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 
 class QObject;
 class QXmlStreamWriter;
@@ -31,7 +33,7 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         bool getSendAsJson() const;
         bool getUseUppercaseData() const;
         const QString& getTemplateName() const;
-        const QString getTemplateData() const;
+        const QString& getTemplateData() const;
         const QList<KeyValueModel>& getTemplateDataModels() const;
         bool getTriggerOnNext() const;
 
@@ -44,6 +46,8 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         void setTemplateDataModels(const QList<KeyValueModel>& models);
         void setTriggerOnNext(bool triggerOnNext);
 
+        Q_SIGNAL void liveDataChanged();
+
     private:
         int flashlayer = Template::DEFAULT_FLASHLAYER;
         QString invoke = Template::DEFAULT_INVOKE;
@@ -53,6 +57,11 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         QList<KeyValueModel> models;
         bool triggerOnNext = Template::DEFAULT_TRIGGER_ON_NEXT;
         bool sendAsJson = Template::DEFAULT_SEND_AS_JSON;
+        mutable QString templateData;
+        mutable QList<QString> componentData;
+
+        void invalidateTemplateData(bool components);
+        QString encodeComponentData(const KeyValueModel& model) const;
 
         Q_SIGNAL void flashlayerChanged(int);
         Q_SIGNAL void invokeChanged(const QString&);
@@ -62,4 +71,6 @@ class CORE_EXPORT TemplateCommand : public AbstractCommand
         Q_SIGNAL void templateNameChanged(const QString&);
         Q_SIGNAL void templateDataChanged(const QList<KeyValueModel>&);
         Q_SIGNAL void triggerOnNextChanged(bool);
+
+        Q_SLOT void liveDataValuesChanged(const QStringList&);
 };
@@ -31,24 +31,28 @@ void AutoCommand::setStep(const QString& step)
 {
     this->step = step;
     emit stepChanged(this->step);
+    emit changed();
 }
 
 void AutoCommand::setSpeed(const QString& speed)
 {
     this->speed = speed;
     emit speedChanged(this->speed);
+    emit changed();
 }
 
 void AutoCommand::setTransition(const QString& transition)
 {
     this->transition = transition;
     emit transitionChanged(this->transition);
+    emit changed();
 }
 
 void AutoCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void AutoCommand::readProperties(boost::property_tree::wptree& pt)
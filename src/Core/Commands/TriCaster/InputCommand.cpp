@@ -26,18 +26,21 @@ void InputCommand::setSwitcher(const QString& switcher)
 {
     this->switcher = switcher;
     emit switcherChanged(this->switcher);
+    emit changed();
 }
 
 void InputCommand::setInput(const QString& input)
 {
     this->input = input;
     emit inputChanged(this->input);
+    emit changed();
 }
 
 void InputCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void InputCommand::readProperties(boost::property_tree::wptree& pt)
@@ -21,12 +21,14 @@ void MacroCommand::setMacro(const QString& macro)
 {
     this->macro = macro;
     emit macroChanged(this->macro);
+    emit changed();
 }
 
 void MacroCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void MacroCommand::readProperties(boost::property_tree::wptree& pt)
@@ -26,18 +26,21 @@ void NetworkSourceCommand::setSource(const QString& source)
 {
     this->source = source;
     emit sourceChanged(this->source);
+    emit changed();
 }
 
 void NetworkSourceCommand::setTarget(const QString& target)
 {
     this->target = target;
     emit targetChanged(this->target);
+    emit changed();
 }
 
 void NetworkSourceCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void NetworkSourceCommand::readProperties(boost::property_tree::wptree& pt)
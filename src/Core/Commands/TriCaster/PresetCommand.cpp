@@ -26,18 +26,21 @@ void PresetCommand::setSource(const QString& source)
 {
     this->source = source;
     emit sourceChanged(this->source);
+    emit changed();
 }
 
 void PresetCommand::setPreset(const QString& preset)
 {
     this->preset = preset;
     emit presetChanged(this->preset);
+    emit changed();
 }
 
 void PresetCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void PresetCommand::readProperties(boost::property_tree::wptree& pt)
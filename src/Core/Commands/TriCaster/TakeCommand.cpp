@@ -21,12 +21,14 @@ void TakeCommand::setStep(const QString& step)
 {
     this->step = step;
     emit stepChanged(this->step);
+    emit changed();
 }
 
 void TakeCommand::setTriggerOnNext(bool triggerOnNext)
 {
     this->triggerOnNext = triggerOnNext;
     emit triggerOnNextChanged(this->triggerOnNext);
+    emit changed();
 }
 
 void TakeCommand::readProperties(boost::property_tree::wptree& pt)
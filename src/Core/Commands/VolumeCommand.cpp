@@ -32,24 +32,28 @@ void VolumeCommand::setVolume(float volume)
 {
     this->volume = volume;
     emit volumeChanged(this->volume);
+    emit changed();
 }
 
 void VolumeCommand::setTransitionDuration(int transtitionDuration)
 {
     this->transtitionDuration = transtitionDuration;
     emit transtitionDurationChanged(this->transtitionDuration);
+    emit changed();
 }
 
 void VolumeCommand::setTween(const QString& tween)
 {
     this->tween = tween;
     emit tweenChanged(this->tween);
+    emit changed();
 }
 
 void VolumeCommand::setDefer(bool defer)
 {
     this->defer = defer;
     emit deferChanged(this->defer);
+    emit changed();
 }
 
 void VolumeCommand::readProperties(boost::property_tree::wptree& pt)
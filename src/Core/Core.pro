@@ -84,13 +84,17 @@ HEADERS += \
     Events/ExportPresetEvent.h \
     Commands/CustomCommand.h \
     OscSubscription.h \
+    OscSubscriptionManager.h \
+    StageStateManager.h \
+    CommandScheduler.h \
+    ScheduledTimer.h \
+    StageStateSubscription.h \
+    Models/OscLayerModel.h \
     Events/Inspector/VideolayerChangedEvent.h \
-    Models/OscFileModel.h \
     Events/Inspector/AddTemplateDataEvent.h \
     Events/Action/AddActionItemEvent.h \
     Commands/ChromaCommand.h \
     Models/ChromaModel.h \
-    Events/Rundown/AutoPlayRundownItemEvent.h \
     Events/Inspector/AutoPlayChangedEvent.h \
     Events/Rundown/AutoPlayNextRundownItemEvent.h \
     Models/TriCaster/TriCasterInputModel.h \
@@ -191,6 +195,7 @@ HEADERS += \
     Events/Rundown/CurrentItemChangedEvent.h \
     Commands/Atem/AtemMacroCommand.h \
     OscWebSocketManager.h \
+    LiveDataManager.h \
     Commands/Atem/AtemFadeToBlackCommand.h
 
 SOURCES += \
@@ -269,13 +274,17 @@ SOURCES += \
     Events/ExportPresetEvent.cpp \
     Commands/CustomCommand.cpp \
     OscSubscription.cpp \
+    OscSubscriptionManager.cpp \
+    StageStateManager.cpp \
+    CommandScheduler.cpp \
+    ScheduledTimer.cpp \
+    StageStateSubscription.cpp \
+    Models/OscLayerModel.cpp \
     Events/Inspector/VideolayerChangedEvent.cpp \
-    Models/OscFileModel.cpp \
     Events/Inspector/AddTemplateDataEvent.cpp \
     Events/Action/AddActionItemEvent.cpp \
     Commands/ChromaCommand.cpp \
     Models/ChromaModel.cpp \
-    Events/Rundown/AutoPlayRundownItemEvent.cpp \
     Events/Inspector/AutoPlayChangedEvent.cpp \
     Events/Rundown/AutoPlayNextRundownItemEvent.cpp \
     Models/TriCaster/TriCasterInputModel.cpp \
@@ -376,6 +385,7 @@ SOURCES += \
     Events/Rundown/CurrentItemChangedEvent.cpp \
     Commands/Atem/AtemMacroCommand.cpp \
     OscWebSocketManager.cpp \
+    LiveDataManager.cpp \
     Commands/Atem/AtemFadeToBlackCommand.cpp
 
 DISTFILES += \
@@ -385,7 +395,11 @@ DISTFILES += \
     Sql/ChangeScript-210.sql \
     Sql/ChangeScript-211.sql \
     Sql/ChangeScript-212.sql \
-    Sql/ChangeScript-213.sql
+    Sql/ChangeScript-213.sql \
+    Sql/ChangeScript-214.sql \
+    Sql/ChangeScript-215.sql \
+    Sql/ChangeScript-216.sql \
+    Sql/ChangeScript-217.sql
 
 RESOURCES += \
     Core.qrc
@@ -454,6 +468,13 @@ else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../TriCaster/debug/
 else:macx:LIBS += -L$$OUT_PWD/../TriCaster/ -ltricaster
 else:unix:LIBS += -L$$OUT_PWD/../TriCaster/ -ltricaster
 
+DEPENDPATH += $$OUT_PWD/../Web $$PWD/../Web
+INCLUDEPATH += $$OUT_PWD/../Web $$PWD/../Web
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../Web/release/ -lweb
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../Web/debug/ -lweb
+else:macx:LIBS += -L$$OUT_PWD/../Web/ -lweb
+else:unix:LIBS += -L$$OUT_PWD/../Web/ -lweb
+
 DEPENDPATH += $$OUT_PWD/../Osc $$PWD/../Osc
 INCLUDEPATH += $$OUT_PWD/../Osc $$PWD/../Osc
 win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../Osc/release/ -losc
@@ -1477,62 +1477,6 @@ QList<LibraryModel> DatabaseManager::getLibraryDataByFilter(const QString& filte
     return models;
 }
 
-QList<LibraryModel> DatabaseManager::getLibraryByDeviceId(int deviceId)
-{
-    QMutexLocker locker(&mutex);
-
-    QSqlQuery sql;
-    sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = :Id "
-                "ORDER BY l.Name, l.DeviceId");
-    sql.bindValue(":Id", deviceId);
-
-    if (!sql.exec())
-       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-
-    QList<LibraryModel> models;
-    while (sql.next())
-        models.push_back(LibraryModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(1).toString(),
-                                      sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
-                                      sql.value(5).toString()));
-
-    return models;
-}
-
-QList<LibraryModel> DatabaseManager::getLibraryByDeviceIdAndFilter(int deviceId, const QString& filter)
-{
-    QMutexLocker locker(&mutex);
-
-    QSqlQuery sql;
-
-    if (filter.isEmpty())
-    {
-        sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                    "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = :Id "
-                    "ORDER BY l.Name, l.DeviceId");
-        sql.bindValue(":Id", deviceId);
-    }
-    else // Filter.
-    {
-        sql.prepare("SELECT l.Id, l.Name, d.Name, t.Value, l.ThumbnailId, l.Timecode FROM Library l, Device d, Type t "
-                    "WHERE l.DeviceId = d.Id AND l.TypeId = t.Id AND d.Id = :Id AND l.Name LIKE :Name "
-                    "ORDER BY l.Name, l.DeviceId");
-        sql.bindValue(":Id", deviceId);
-        sql.bindValue(":Name", QString("%%1%").arg(filter));
-    }
-
-    if (!sql.exec())
-       qCritical("Failed to execute sql query: %s, Error: %s", qPrintable(sql.lastQuery()), qPrintable(sql.lastError().text()));
-
-    QList<LibraryModel> models;
-    while (sql.next())
-        models.push_back(LibraryModel(sql.value(0).toInt(), sql.value(1).toString(), sql.value(1).toString(),
-                                      sql.value(2).toString(), sql.value(3).toString(), sql.value(4).toInt(),
-                                      sql.value(5).toString()));
-
-    return models;
-}
-
 QList<LibraryModel> DatabaseManager::getLibraryMediaByDeviceAddress(const QString& address)
 {
     QMutexLocker locker(&mutex);
@@ -5,6 +5,7 @@
 #include "Events/MediaChangedEvent.h"
 #include "Events/Inspector/TemplateChangedEvent.h"
 #include "Models/DeviceModel.h"
+#include "Models/FormatModel.h"
 
 #include <stdexcept>
 
@@ -28,6 +29,9 @@ DeviceManager& DeviceManager::getInstance()
 
 void DeviceManager::initialize()
 {
+    foreach (const FormatModel& format, DatabaseManager::getInstance().getFormat())
+        this->formatFramesPerSecond.insert(format.getName(), format.getFramesPerSecond().toDouble());
+
     QList<DeviceModel> models = DatabaseManager::getInstance().getDevice();
     foreach (const DeviceModel& model, models)
     {
@@ -35,11 +39,14 @@ void DeviceManager::initialize()
 
         this->deviceModels.insert(model.getName(), model);
         this->devices.insert(model.getName(), device);
+        updateChannelFramesPerSecond(model);
 
         emit deviceAdded(*device);
 
         device->connectDevice();
     }
+
+    updateShadowDevices();
 }
 
 void DeviceManager::uninitialize()
@@ -76,6 +83,7 @@ void DeviceManager::refresh()
 
             this->devices.remove(key);
             this->deviceModels.remove(key);
+            this->channelFramesPerSecond.remove(key);
 
             emit deviceRemoved();
         }
@@ -90,12 +98,71 @@ void DeviceManager::refresh()
 
             this->deviceModels.insert(model.getName(), model);
             this->devices.insert(model.getName(), device);
+            updateChannelFramesPerSecond(model);
 
             emit deviceAdded(*device);
 
             device->connectDevice();
         }
     }
+
+    updateShadowDevices();
+}
+
+void DeviceManager::updateShadowDevices()
+{
+    // Looked up once per device change instead of on every take.
+    this->shadowDevices.clear();
+    foreach (const DeviceModel& model, this->deviceModels)
+    {
+        if (model.getShadow() == "No")
+            continue;
+
+        const QSharedPointer<CasparDevice> device = this->devices.value(model.getName());
+        if (device != NULL)
+            this->shadowDevices.append(device);
+    }
+}
+
+void DeviceManager::updateChannelFramesPerSecond(const DeviceModel& model)
+{
+    // Looked up once per format change instead of on every take.
+    QList<double> framesPerSecond;
+    if (!model.getChannelFormats().isEmpty())
+    {
+        foreach (const QString& format, model.getChannelFormats().split(","))
+            framesPerSecond.append(this->formatFramesPerSecond.value(format, 0));
+    }
+
+    this->channelFramesPerSecond.insert(model.getName(), framesPerSecond);
+}
+
+void DeviceManager::updateChannelFormats(const QString& address, const QString& channelFormats)
+{
+    for (QMap<QString, DeviceModel>::iterator iterator = this->deviceModels.begin(); iterator != this->deviceModels.end(); ++iterator)
+    {
+        const DeviceModel& model = iterator.value();
+        if (model.getAddress() != address)
+            continue;
+
+        iterator.value() = DeviceModel(model.getId(), model.getName(), model.getAddress(), model.getPort(), model.getUsername(), model.getPassword(),
+                                       model.getDescription(), model.getVersion(), model.getShadow(), model.getChannels(), channelFormats,
+                                       model.getPreviewChannel(), model.getLockedChannel());
+        updateChannelFramesPerSecond(iterator.value());
+    }
+}
+
+/*
+ * Returns the frames per second of the format the channel runs, 0 when the
+ * device or the channel is unknown.
+ */
+double DeviceManager::getFramesPerSecond(const QString& name, int channel) const
+{
+    const QList<double> framesPerSecond = this->channelFramesPerSecond.value(name);
+    if (channel < 1 || channel > framesPerSecond.count())
+        return 0;
+
+    return framesPerSecond[channel - 1];
 }
 
 QList<DeviceModel> DeviceManager::getDeviceModels() const
@@ -142,3 +209,21 @@ const QSharedPointer<CasparDevice> DeviceManager::getDeviceByName(const QString&
 {
     return this->devices.value(name);
 }
+
+const QList<QSharedPointer<CasparDevice>>& DeviceManager::getShadowDevices() const
+{
+    return this->shadowDevices;
+}
+
+void DeviceManager::beginGroup()
+{
+    // Commands sent until the group is committed are written to each server at once.
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->beginGroup();
+}
+
+void DeviceManager::commitGroup()
+{
+    foreach (const QSharedPointer<CasparDevice>& device, this->devices)
+        device->commitGroup();
+}
@@ -5,6 +5,7 @@
 
 #include "CasparDevice.h"
 
+#include <QtCore/QList>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
@@ -28,6 +29,13 @@ class CORE_EXPORT DeviceManager : public QObject
 
         int getDeviceCount() const;
         const QSharedPointer<CasparDevice> getDeviceByName(const QString& name) const;
+        const QList<QSharedPointer<CasparDevice>>& getShadowDevices() const;
+
+        double getFramesPerSecond(const QString& name, int channel) const;
+        void updateChannelFormats(const QString& address, const QString& channelFormats);
+
+        void beginGroup();
+        void commitGroup();
 
         Q_SIGNAL void deviceRemoved();
         Q_SIGNAL void deviceAdded(CasparDevice&);
@@ -35,5 +43,11 @@ class CORE_EXPORT DeviceManager : public QObject
     private:
         QMap<QString, DeviceModel> deviceModels;
         QMap<QString, QSharedPointer<CasparDevice>> devices;
+        QList<QSharedPointer<CasparDevice>> shadowDevices;
+        QMap<QString, double> formatFramesPerSecond;
+        QMap<QString, QList<double>> channelFramesPerSecond;
+
+        void updateShadowDevices();
+        void updateChannelFramesPerSecond(const DeviceModel& model);
 };
 
@@ -316,11 +316,6 @@ void EventManager::fireSaveAsPresetEvent(const SaveAsPresetEvent& event)
     emit saveAsPreset(event);
 }
 
-void EventManager::fireAutoPlayRundownItemEvent(const AutoPlayRundownItemEvent& event)
-{
-    emit autoPlayRundownItem(event);
-}
-
 void EventManager::fireAddPresetItemEvent(const AddPresetItemEvent& event)
 {
     emit addPresetItem(event);
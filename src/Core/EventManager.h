@@ -40,7 +40,6 @@
 #include "Events/Rundown/AddRudnownItemEvent.h"
 #include "Events/Rundown/AllowRemoteTriggeringMenuEvent.h"
 #include "Events/Rundown/AutoPlayNextRundownItemEvent.h"
-#include "Events/Rundown/AutoPlayRundownItemEvent.h"
 #include "Events/Rundown/CloseRundownEvent.h"
 #include "Events/Rundown/CompactViewEvent.h"
 #include "Events/Rundown/DeleteRundownEvent.h"
@@ -138,7 +137,6 @@ class CORE_EXPORT EventManager : public QObject
         Q_SIGNAL void toggleCompactView(const CompactViewEvent&);
         Q_SIGNAL void executeRundownItem(const ExecuteRundownItemEvent&);
         Q_SIGNAL void allowRemoteTriggering(const AllowRemoteTriggeringEvent&);
-        Q_SIGNAL void autoPlayRundownItem(const AutoPlayRundownItemEvent&);
         Q_SIGNAL void autoPlayChanged(const AutoPlayChangedEvent&);
         Q_SIGNAL void autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent&);
         Q_SIGNAL void showAddTemplateDataDialog(const ShowAddTemplateDataDialogEvent&);
@@ -213,7 +211,6 @@ class CORE_EXPORT EventManager : public QObject
         void fireToggleCompactViewEvent(const CompactViewEvent& event);
         void fireExecuteRundownItemEvent(const ExecuteRundownItemEvent& event);
         void fireAllowRemoteTriggeringEvent(const AllowRemoteTriggeringEvent& event);
-        void fireAutoPlayRundownItemEvent(const AutoPlayRundownItemEvent&);
         void fireAutoPlayNextRundownItemEvent(const AutoPlayNextRundownItemEvent&);
         void fireShowAddTemplateDataDialogEvent(const ShowAddTemplateDataDialogEvent&);
         void fireMarkItemAsUsedEvent(const MarkItemAsUsedEvent&);
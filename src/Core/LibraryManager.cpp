@@ -11,6 +11,7 @@
 #include "Models/DeviceModel.h"
 
 #include <QtCore/QSharedPointer>
+#include <QtCore/QtAlgorithms>
 #include <QtCore/QTime>
 #include <QtCore/QTimer>
 #include <QtCore/QStringList>
@@ -19,6 +20,20 @@
 
 Q_GLOBAL_STATIC(LibraryManager, libraryManager)
 
+static const int TARGET_DELTA_LIMIT = 100; // Larger changes are reloaded in one query instead of row by row.
+
+static QString getTargetKey(const QString& deviceAddress, const QString& type)
+{
+    return QString("%1/%2").arg(deviceAddress).arg(type);
+}
+
+static int getTargetRow(const QStringListModel* model, const QString& name)
+{
+    // The copy shares the list of the model, it must be gone before the model is changed.
+    const QStringList names = model->stringList();
+    return qLowerBound(names.begin(), names.end(), name) - names.begin();
+}
+
 LibraryManager::LibraryManager(QObject* parent)
     : QObject(parent)
 {
@@ -45,6 +60,98 @@ void LibraryManager::uninitialize()
 {
 }
 
+QAbstractItemModel* LibraryManager::getTargetModel(const QString& deviceAddress, const QString& type)
+{
+    if (type != Rundown::MOVIE && type != Rundown::AUDIO && type != Rundown::STILL && type != Rundown::TEMPLATE)
+        return NULL;
+
+    if (!this->targetDeviceAddresses.contains(deviceAddress))
+        loadTargets(deviceAddress);
+
+    return this->targetModels.value(getTargetKey(deviceAddress, type));
+}
+
+void LibraryManager::loadTargets(const QString& deviceAddress)
+{
+    QMap<QString, QStringList> targets;
+    targets.insert(Rundown::MOVIE, QStringList());
+    targets.insert(Rundown::AUDIO, QStringList());
+    targets.insert(Rundown::STILL, QStringList());
+    targets.insert(Rundown::TEMPLATE, QStringList());
+
+    foreach (const LibraryModel& model, DatabaseManager::getInstance().getLibraryMediaByDeviceAddress(deviceAddress))
+    {
+        if (targets.contains(model.getType()))
+            targets[model.getType()].append(model.getName());
+    }
+
+    foreach (const LibraryModel& model, DatabaseManager::getInstance().getLibraryTemplateByDeviceAddress(deviceAddress))
+        targets[Rundown::TEMPLATE].append(model.getName());
+
+    foreach (const QString& type, targets.keys())
+    {
+        QStringList& names = targets[type];
+        qSort(names);
+
+        // Models are kept once created, inspectors hold on to them.
+        QStringListModel* model = this->targetModels.value(getTargetKey(deviceAddress, type));
+        if (model == NULL)
+        {
+            model = new QStringListModel(this);
+            this->targetModels.insert(getTargetKey(deviceAddress, type), model);
+        }
+
+        model->setStringList(names);
+    }
+
+    this->targetDeviceAddresses.insert(deviceAddress);
+}
+
+void LibraryManager::updateTargets(const QString& deviceAddress, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels)
+{
+    if (!this->targetDeviceAddresses.contains(deviceAddress))
+        return; // Loaded when first asked for.
+
+    if (deleteModels.count() + insertModels.count() > TARGET_DELTA_LIMIT)
+    {
+        loadTargets(deviceAddress);
+        return;
+    }
+
+    foreach (const LibraryModel& libraryModel, deleteModels)
+    {
+        QStringListModel* model = this->targetModels.value(getTargetKey(deviceAddress, libraryModel.getType()));
+        if (model == NULL)
+            continue;
+
+        int row = getTargetRow(model, libraryModel.getName());
+        if (row < model->rowCount() && model->index(row).data().toString() == libraryModel.getName())
+            model->removeRow(row);
+    }
+
+    foreach (const LibraryModel& libraryModel, insertModels)
+    {
+        QStringListModel* model = this->targetModels.value(getTargetKey(deviceAddress, libraryModel.getType()));
+        if (model == NULL)
+            continue;
+
+        int row = getTargetRow(model, libraryModel.getName());
+        if (row < model->rowCount() && model->index(row).data().toString() == libraryModel.getName())
+            continue;
+
+        model->insertRow(row);
+        model->setData(model->index(row), libraryModel.getName());
+    }
+}
+
+void LibraryManager::resetTargets()
+{
+    foreach (QStringListModel* model, this->targetModels)
+        model->setStringList(QStringList());
+
+    this->targetDeviceAddresses.clear();
+}
+
 void LibraryManager::refreshLibrary(const RefreshLibraryEvent& event)
 {
     QTimer::singleShot(event.getDelay(), this, SLOT(refresh()));
@@ -101,6 +208,8 @@ void LibraryManager::refresh()
 
 void LibraryManager::deviceRemoved()
 {
+    resetTargets();
+
     EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
     EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
     EventManager::getInstance().fireDataChangedEvent(DataChangedEvent());
@@ -130,6 +239,7 @@ void LibraryManager::infoChanged(const QList<QString>& info, CasparDevice& devic
 
     DatabaseManager::getInstance().updateDeviceChannels(DeviceModel(0, "", device.getAddress(), 0, "", "", "", "", "", info.count(), "", 0, 0));
     DatabaseManager::getInstance().updateDeviceChannelFormats(DeviceModel(0, "", device.getAddress(), 0, "", "", "", "", "", 0, channelFormats.join(","), 0, 0));
+    DeviceManager::getInstance().updateChannelFormats(device.getAddress(), channelFormats.join(","));
 }
 
 void LibraryManager::connectionStateChanged(CasparDevice& device)
@@ -190,6 +300,7 @@ void LibraryManager::mediaChanged(const QList<CasparMedia>& mediaItems, CasparDe
     if (deleteModels.count() > 0 || insertModels.count() > 0)
     {
         DatabaseManager::getInstance().updateLibraryMedia(device.getAddress(), deleteModels, insertModels);
+        updateTargets(device.getAddress(), deleteModels, insertModels);
         EventManager::getInstance().fireMediaChangedEvent(MediaChangedEvent());
     }
 
@@ -236,6 +347,7 @@ void LibraryManager::templateChanged(const QList<CasparTemplate>& templateItems,
     if (deleteModels.count() > 0 || insertModels.count() > 0)
     {
         DatabaseManager::getInstance().updateLibraryTemplate(device.getAddress(), deleteModels, insertModels);
+        updateTargets(device.getAddress(), deleteModels, insertModels);
         EventManager::getInstance().fireTemplateChangedEvent(TemplateChangedEvent());
     }
 
@@ -13,9 +13,15 @@
 #include "Models/CasparMedia.h"
 #include "Models/CasparTemplate.h"
 #include "Models/CasparThumbnail.h"
+#include "Models/LibraryModel.h"
 
+#include <QtCore/QAbstractItemModel>
+#include <QtCore/QList>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QSet>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QStringListModel>
 #include <QtCore/QTimer>
 
 class CORE_EXPORT LibraryManager : public QObject
@@ -30,9 +36,17 @@ class CORE_EXPORT LibraryManager : public QObject
         void initialize();
         void uninitialize();
 
+        QAbstractItemModel* getTargetModel(const QString& deviceAddress, const QString& type);
+
     private:
         QTimer refreshTimer;
         QList<QSharedPointer<ThumbnailWorker>> thumbnailWorkers;
+        QSet<QString> targetDeviceAddresses;
+        QMap<QString, QStringListModel*> targetModels;
+
+        void loadTargets(const QString& deviceAddress);
+        void updateTargets(const QString& deviceAddress, const QList<LibraryModel>& deleteModels, const QList<LibraryModel>& insertModels);
+        void resetTargets();
 
         Q_SLOT void refresh();
         Q_SLOT void deviceRemoved();
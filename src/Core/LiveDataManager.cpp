@@ -0,0 +1,208 @@
+#include "LiveDataManager.h"
+#include "DatabaseManager.h"
+#include "OscDeviceManager.h"
+#include "OscWebSocketManager.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QTextStream>
+#include <QtCore/QUrlQuery>
+
+Q_GLOBAL_STATIC(LiveDataManager, liveDataManager)
+
+static const QString LIVE_DATA_PATH = "/livedata/";
+
+LiveDataManager::LiveDataManager()
+    : updateInterval(0), requestPending(false), request(NULL)
+{
+}
+
+LiveDataManager& LiveDataManager::getInstance()
+{
+    return *liveDataManager();
+}
+
+void LiveDataManager::initialize()
+{
+    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(OscDeviceManager::getInstance().getOscTcpListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(OscWebSocketManager::getInstance().getOscWebSocketListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+
+    this->updateInterval = DatabaseManager::getInstance().getConfigurationByName("LiveDataUpdateInterval").getValue().toInt();
+
+    this->url = DatabaseManager::getInstance().getConfigurationByName("LiveDataUrl").getValue().trimmed();
+    if (!this->url.isEmpty())
+    {
+        this->request = new HttpRequest(this);
+        QObject::connect(this->request, SIGNAL(responseReceived(const QString&)), this, SLOT(responseReceived(const QString&)));
+        QObject::connect(this->request, SIGNAL(requestFailed(const QString&)), this, SLOT(requestFailed(const QString&)));
+
+        int pollInterval = DatabaseManager::getInstance().getConfigurationByName("LiveDataPollInterval").getValue().toInt();
+
+        QObject::connect(&this->pollTimer, SIGNAL(timeout()), this, SLOT(poll()));
+        this->pollTimer.start(qMax(pollInterval, 100));
+
+        poll();
+    }
+
+    this->path = DatabaseManager::getInstance().getConfigurationByName("LiveDataFile").getValue().trimmed();
+    if (!this->path.isEmpty())
+    {
+        QObject::connect(&this->fileWatcher, SIGNAL(fileChanged(const QString&)), this, SLOT(fileChanged(const QString&)));
+        this->fileWatcher.addPath(this->path);
+
+        fileChanged(this->path);
+    }
+}
+
+void LiveDataManager::uninitialize()
+{
+    this->pollTimer.stop();
+
+    if (!this->path.isEmpty())
+        this->fileWatcher.removePath(this->path);
+}
+
+QString LiveDataManager::getBoundKey(const QString& value)
+{
+    if (value.length() > 4 && value.startsWith("{{") && value.endsWith("}}"))
+        return value.mid(2, value.length() - 4).trimmed();
+
+    return QString();
+}
+
+bool LiveDataManager::contains(const QString& key) const
+{
+    return this->values.contains(key);
+}
+
+QString LiveDataManager::getValue(const QString& key) const
+{
+    return this->values.value(key);
+}
+
+int LiveDataManager::reserveUpdate(const QString& layerKey)
+{
+    // Returns the milliseconds until the layer may be updated again, 0 when the update can be sent now.
+    QElapsedTimer& timer = this->updates[layerKey];
+    if (timer.isValid() && timer.elapsed() < this->updateInterval)
+        return this->updateInterval - timer.elapsed();
+
+    timer.start();
+
+    return 0;
+}
+
+void LiveDataManager::claimLayer(const QString& layerKey, QObject* owner)
+{
+    this->owners.insert(layerKey, owner);
+}
+
+bool LiveDataManager::ownsLayer(const QString& layerKey, QObject* owner) const
+{
+    return this->owners.value(layerKey) == owner;
+}
+
+void LiveDataManager::updateValues(const QMap<QString, QString>& values)
+{
+    QStringList keys;
+    for (QMap<QString, QString>::const_iterator iterator = values.constBegin(); iterator != values.constEnd(); ++iterator)
+    {
+        QHash<QString, QString>::iterator value = this->values.find(iterator.key());
+        if (value != this->values.end() && value.value() == iterator.value())
+            continue;
+
+        this->values.insert(iterator.key(), iterator.value());
+        keys.append(iterator.key());
+    }
+
+    if (!keys.isEmpty())
+        emit valuesChanged(keys);
+}
+
+QMap<QString, QString> LiveDataManager::parseValues(const QString& data) const
+{
+    QMap<QString, QString> values;
+
+    // A flat JSON object, otherwise one key=value pair per line.
+    QJsonDocument document = QJsonDocument::fromJson(data.toUtf8());
+    if (document.isObject())
+    {
+        QJsonObject object = document.object();
+        for (QJsonObject::const_iterator iterator = object.constBegin(); iterator != object.constEnd(); ++iterator)
+            values.insert(iterator.key(), iterator.value().toVariant().toString());
+
+        return values;
+    }
+
+    foreach (const QString& line, data.split('\n', QString::SkipEmptyParts))
+    {
+        int index = line.indexOf('=');
+        if (index <= 0)
+            continue;
+
+        values.insert(line.left(index).trimmed(), line.mid(index + 1).trimmed());
+    }
+
+    return values;
+}
+
+void LiveDataManager::poll()
+{
+    // A slow server is not asked again before it has answered.
+    if (this->requestPending)
+        return;
+
+    this->requestPending = true;
+    this->request->sendGet(this->url, QUrlQuery());
+}
+
+void LiveDataManager::responseReceived(const QString& data)
+{
+    this->requestPending = false;
+
+    updateValues(parseValues(data));
+}
+
+void LiveDataManager::requestFailed(const QString& error)
+{
+    Q_UNUSED(error);
+
+    // The values are kept until the server answers again.
+    this->requestPending = false;
+}
+
+void LiveDataManager::fileChanged(const QString& path)
+{
+    // Editors that save by replacing the file drop it from the watcher.
+    if (!this->fileWatcher.files().contains(path))
+        this->fileWatcher.addPath(path);
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return;
+
+    QTextStream stream(&file);
+    stream.setCodec("UTF-8");
+
+    updateValues(parseValues(stream.readAll()));
+}
+
+void LiveDataManager::messageReceived(const QString& path, const QList<QVariant>& arguments)
+{
+    if (arguments.isEmpty())
+        return;
+
+    int index = path.indexOf(LIVE_DATA_PATH);
+    if (index < 0)
+        return;
+
+    QMap<QString, QString> values;
+    values.insert(path.mid(index + LIVE_DATA_PATH.length()), arguments.first().toString());
+
+    updateValues(values);
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "HttpRequest.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+
+/*
+ * Collects live data such as scores and tickers from an HTTP URL that is
+ * polled, a watched file and OSC messages sent to /livedata/<key>. Template
+ * fields bound with {{key}} take the current value of the key. Only keys
+ * whose value actually changed are announced, and updates to a template
+ * layer are limited to one per update interval. Only the item which played
+ * last on a template layer may update it.
+ */
+class CORE_EXPORT LiveDataManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit LiveDataManager();
+
+        static LiveDataManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        static QString getBoundKey(const QString& value);
+
+        bool contains(const QString& key) const;
+        QString getValue(const QString& key) const;
+        int reserveUpdate(const QString& layerKey);
+        void claimLayer(const QString& layerKey, QObject* owner);
+        bool ownsLayer(const QString& layerKey, QObject* owner) const;
+
+        Q_SIGNAL void valuesChanged(const QStringList&);
+
+    private:
+        QString url;
+        QString path;
+        int updateInterval;
+        bool requestPending;
+        QTimer pollTimer;
+        QFileSystemWatcher fileWatcher;
+        HttpRequest* request;
+
+        QHash<QString, QString> values;
+        QHash<QString, QElapsedTimer> updates;
+        QHash<QString, QPointer<QObject>> owners;
+
+        void updateValues(const QMap<QString, QString>& values);
+        QMap<QString, QString> parseValues(const QString& data) const;
+
+        Q_SLOT void poll();
+        Q_SLOT void responseReceived(const QString&);
+        Q_SLOT void requestFailed(const QString&);
+        Q_SLOT void fileChanged(const QString&);
+        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+};
@@ -0,0 +1,116 @@
+#include "OscLayerModel.h"
+
+OscLayerModel::OscLayerModel()
+    : currentTime(0), totalTime(0), currentFrame(0), totalFrames(0), frameReceipt(-1), fps(0), path(""), paused(false), loop(false), active(false), timestamp(0)
+{
+}
+
+double OscLayerModel::getTime() const
+{
+    return this->currentTime;
+}
+
+void OscLayerModel::setTime(double currentTime)
+{
+    this->currentTime = currentTime;
+}
+
+double OscLayerModel::getTotalTime() const
+{
+    return this->totalTime;
+}
+
+void OscLayerModel::setTotalTime(double totalTime)
+{
+    this->totalTime = totalTime;
+}
+
+int OscLayerModel::getFrame() const
+{
+    return this->currentFrame;
+}
+
+void OscLayerModel::setFrame(int currentFrame)
+{
+    this->currentFrame = currentFrame;
+}
+
+int OscLayerModel::getTotalFrames() const
+{
+    return this->totalFrames;
+}
+
+void OscLayerModel::setTotalFrames(int totalFrames)
+{
+    this->totalFrames = totalFrames;
+}
+
+qint64 OscLayerModel::getFrameReceipt() const
+{
+    return this->frameReceipt;
+}
+
+void OscLayerModel::setFrameReceipt(qint64 frameReceipt)
+{
+    this->frameReceipt = frameReceipt;
+}
+
+double OscLayerModel::getFramesPerSecond() const
+{
+    return this->fps;
+}
+
+void OscLayerModel::setFramesPerSecond(double fps)
+{
+    this->fps = fps;
+}
+
+const QString& OscLayerModel::getPath() const
+{
+    return this->path;
+}
+
+void OscLayerModel::setPath(const QString& path)
+{
+    this->path = path;
+}
+
+bool OscLayerModel::getPaused() const
+{
+    return this->paused;
+}
+
+void OscLayerModel::setPaused(bool paused)
+{
+    this->paused = paused;
+}
+
+bool OscLayerModel::getLoop() const
+{
+    return this->loop;
+}
+
+void OscLayerModel::setLoop(bool loop)
+{
+    this->loop = loop;
+}
+
+bool OscLayerModel::isActive() const
+{
+    return this->active;
+}
+
+void OscLayerModel::setActive(bool active)
+{
+    this->active = active;
+}
+
+qint64 OscLayerModel::getTimestamp() const
+{
+    return this->timestamp;
+}
+
+void OscLayerModel::setTimestamp(qint64 timestamp)
+{
+    this->timestamp = timestamp;
+}
@@ -4,10 +4,10 @@
 
 #include <QtCore/QString>
 
-class CORE_EXPORT OscFileModel
+class CORE_EXPORT OscLayerModel
 {
     public:
-        explicit OscFileModel();
+        explicit OscLayerModel();
 
         double getTime() const;
         void setTime(double currentTime);
@@ -21,19 +21,37 @@ class CORE_EXPORT OscFileModel
         int getTotalFrames() const;
         void setTotalFrames(int totalFrames);
 
+        qint64 getFrameReceipt() const;
+        void setFrameReceipt(qint64 frameReceipt);
+
         double getFramesPerSecond() const;
         void setFramesPerSecond(double fps);
 
         const QString& getPath() const;
         void setPath(const QString& path);
 
+        bool getPaused() const;
+        void setPaused(bool paused);
+
+        bool getLoop() const;
+        void setLoop(bool loop);
+
+        bool isActive() const;
+        void setActive(bool active);
+
+        qint64 getTimestamp() const;
+        void setTimestamp(qint64 timestamp);
+
     private:
         double currentTime;
         double totalTime;
         int currentFrame;
         int totalFrames;
+        qint64 frameReceipt;
         double fps;
         QString path;
+        bool paused;
+        bool loop;
+        bool active;
+        qint64 timestamp;
 };
-
-
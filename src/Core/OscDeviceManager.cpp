@@ -1,10 +1,16 @@
 #include "OscDeviceManager.h"
 #include "DatabaseManager.h"
+#include "EventManager.h"
+#include "Events/StatusbarEvent.h"
 
 #include <QtCore/QSharedPointer>
+#include <QtCore/QTimer>
 
 Q_GLOBAL_STATIC(OscDeviceManager, oscDeviceManager)
 
+static const int REPORT_DELAY = 500; // The listener dispatches the last batch of the replay first.
+static const int TCP_STATISTICS_LOG_INTERVAL = 10000;
+
 OscDeviceManager::OscDeviceManager()
 {
 }
@@ -20,12 +26,24 @@ void OscDeviceManager::initialize()
 
     QString oscPort = DatabaseManager::getInstance().getConfigurationByName("OscPort").getValue();
     this->oscListener = QSharedPointer<OscListener>(new OscListener("0.0.0.0", (oscPort.isEmpty() == true) ? Osc::DEFAULT_PORT : oscPort.toInt()));
+
+    QString oscTcpPort = DatabaseManager::getInstance().getConfigurationByName("OscTcpPort").getValue();
+    this->oscTcpListener = QSharedPointer<OscTcpListener>(new OscTcpListener());
+
+    QObject::connect(this->oscListener.data(), SIGNAL(replayStarted()), this, SLOT(replayStarted()));
+    QObject::connect(this->oscListener.data(), SIGNAL(replayFinished()), this, SLOT(replayFinished()));
+    QObject::connect(this->oscTcpListener.data(), SIGNAL(statisticsUpdated()), this, SLOT(tcpStatisticsUpdated()));
+
     if (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true")
+    {
         this->oscListener->start();
+        this->oscTcpListener->start((oscTcpPort.isEmpty() == true) ? Osc::DEFAULT_TCP_PORT : oscTcpPort.toInt());
+    }
 }
 
 void OscDeviceManager::uninitialize()
 {
+    this->watchdog.stop();
 }
 
 const QSharedPointer<OscSender> OscDeviceManager::getOscSender() const
@@ -37,3 +55,53 @@ const QSharedPointer<OscListener> OscDeviceManager::getOscListener() const
 {
     return this->oscListener;
 }
+
+const QSharedPointer<OscTcpListener> OscDeviceManager::getOscTcpListener() const
+{
+    return this->oscTcpListener;
+}
+
+void OscDeviceManager::tcpStatisticsUpdated()
+{
+    if (this->tcpStatisticsClock.isValid() && this->tcpStatisticsClock.elapsed() < TCP_STATISTICS_LOG_INTERVAL)
+        return;
+
+    this->tcpStatisticsClock.start();
+
+    foreach (const OscTcpListener::ClientStatistics& statistics, this->oscTcpListener->getClientStatistics())
+    {
+        qDebug("OSC TCP client %s: %.0f messages/s, %.0f bytes/s, %llu messages, %llu dropped%s",
+               qPrintable(statistics.address), statistics.messagesPerSecond, statistics.bytesPerSecond,
+               statistics.messages, statistics.droppedPackets, statistics.throttled ? ", throttled" : "");
+    }
+}
+
+void OscDeviceManager::replayStarted()
+{
+    qDebug("Replay of OSC recording started");
+
+    this->watchdog.start();
+}
+
+void OscDeviceManager::replayFinished()
+{
+    QTimer::singleShot(REPORT_DELAY, this, SLOT(reportReplay()));
+}
+
+void OscDeviceManager::reportReplay()
+{
+    this->watchdog.stop();
+
+    OscListener::Statistics statistics = this->oscListener->getStatistics();
+
+    quint64 dropped = (statistics.sentMessages > statistics.receivedMessages) ? statistics.sentMessages - statistics.receivedMessages : 0;
+    qint64 averageLatency = (statistics.dispatchedMessages > 0) ? statistics.totalDispatchLatency / statistics.dispatchedMessages : 0;
+
+    qDebug("Replay of OSC recording finished, received %llu of %llu messages, dropped %llu, dispatched %llu",
+           statistics.receivedMessages, statistics.sentMessages, dropped, statistics.dispatchedMessages);
+    qDebug("OSC dispatch latency: average %lld us, max %lld us", averageLatency, statistics.maxDispatchLatency);
+    qDebug("Main thread stall: total %lld ms, max %lld ms", this->watchdog.getTotalStall() / 1000, this->watchdog.getMaxStall() / 1000);
+
+    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("OSC replay: %1 messages dropped, dispatch latency %2 us max, main thread stall %3 ms max")
+                                                                  .arg(dropped).arg(statistics.maxDispatchLatency).arg(this->watchdog.getMaxStall() / 1000), 10000));
+}
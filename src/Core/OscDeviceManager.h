@@ -4,7 +4,10 @@
 
 #include "OscSender.h"
 #include "OscListener.h"
+#include "OscStallWatchdog.h"
+#include "OscTcpListener.h"
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
 
@@ -22,9 +25,21 @@ class CORE_EXPORT OscDeviceManager : public QObject
 
         const QSharedPointer<OscSender> getOscSender() const;
         const QSharedPointer<OscListener> getOscListener() const;
+        const QSharedPointer<OscTcpListener> getOscTcpListener() const;
 
     private:
         QSharedPointer<OscSender> oscSender;
         QSharedPointer<OscListener> oscListener;
+        QSharedPointer<OscTcpListener> oscTcpListener;
+
+        // Measures how the client keeps up while a recording is replayed into it.
+        OscStallWatchdog watchdog;
+
+        QElapsedTimer tcpStatisticsClock;
+
+        Q_SLOT void tcpStatisticsUpdated();
+        Q_SLOT void replayStarted();
+        Q_SLOT void replayFinished();
+        Q_SLOT void reportReplay();
 };
 
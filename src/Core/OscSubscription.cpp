@@ -1,26 +1,44 @@
 #include "OscSubscription.h"
-#include "OscDeviceManager.h"
-#include "OscWebSocketManager.h"
+#include "OscSubscriptionManager.h"
 
 #include <QtCore/QDebug>
 #include <QtCore/QSharedPointer>
 
 OscSubscription::OscSubscription(const QString& path, QObject *parent)
     : QObject(parent),
-      path(path)
+      path(path), subscribed(false)
 {  
-    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
-    QObject::connect(OscWebSocketManager::getInstance().getOscWebSocketListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
 }
 
-void OscSubscription::messageReceived(const QString& pattern, const QList<QVariant>& arguments)
+OscSubscription::~OscSubscription()
 {
-    if (pattern.endsWith(this->path))
+    if (this->subscribed)
+        OscSubscriptionManager::getInstance().unsubscribe(this);
+}
+
+const QString& OscSubscription::getPath() const
+{
+    return this->path;
+}
+
+void OscSubscription::connectNotify(const QMetaMethod& signal)
+{
+    // Messages are only dispatched while someone is listening.
+    if (!this->subscribed && signal == QMetaMethod::fromSignal(&OscSubscription::subscriptionReceived))
     {
-        //qDebug("Found a subscriber: %s:%s", qPrintable(this->parent()), qPrintable(this->path));
+        OscSubscriptionManager::getInstance().subscribe(this);
+        this->subscribed = true;
+    }
+}
 
-        emit subscriptionReceived(this->path, arguments);
+void OscSubscription::disconnectNotify(const QMetaMethod& signal)
+{
+    Q_UNUSED(signal);
+
+    // Subscriptions are released by disconnecting them.
+    if (this->subscribed && !QObject::isSignalConnected(QMetaMethod::fromSignal(&OscSubscription::subscriptionReceived)))
+    {
+        OscSubscriptionManager::getInstance().unsubscribe(this);
+        this->subscribed = false;
     }
 }
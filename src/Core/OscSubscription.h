@@ -3,6 +3,7 @@
 #include "Shared.h"
 
 #include <QtCore/QList>
+#include <QtCore/QMetaMethod>
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
@@ -14,11 +15,17 @@ class CORE_EXPORT OscSubscription : public QObject
 
     public:
         explicit OscSubscription(const QString& path, QObject* parent = 0);
+        ~OscSubscription();
+
+        const QString& getPath() const;
 
         Q_SIGNAL void subscriptionReceived(const QString&, const QList<QVariant>&);
 
+    protected:
+        void connectNotify(const QMetaMethod& signal);
+        void disconnectNotify(const QMetaMethod& signal);
+
     private:
         QString path;
-
-        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+        bool subscribed;
 };
@@ -0,0 +1,102 @@
+#include "OscSubscriptionManager.h"
+#include "OscSubscription.h"
+#include "OscDeviceManager.h"
+#include "OscWebSocketManager.h"
+
+Q_GLOBAL_STATIC(OscSubscriptionManager, oscSubscriptionManager)
+
+OscSubscriptionManager::OscSubscriptionManager()
+{
+}
+
+OscSubscriptionManager& OscSubscriptionManager::getInstance()
+{
+    return *oscSubscriptionManager();
+}
+
+void OscSubscriptionManager::initialize()
+{
+    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(OscDeviceManager::getInstance().getOscTcpListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+    QObject::connect(OscWebSocketManager::getInstance().getOscWebSocketListener().data(), SIGNAL(commandReceived(quint64, const QString&, const QList<QVariant>&)),
+                     this, SLOT(commandReceived(quint64, const QString&, const QList<QVariant>&)));
+}
+
+void OscSubscriptionManager::uninitialize()
+{
+}
+
+void OscSubscriptionManager::subscribe(OscSubscription* subscription)
+{
+    if (subscription->getPath().startsWith('/'))
+        this->subscriptions.insert(subscription->getPath(), subscription);
+    else
+        this->patternSubscriptions.append(subscription);
+}
+
+void OscSubscriptionManager::unsubscribe(OscSubscription* subscription)
+{
+    if (subscription->getPath().startsWith('/'))
+        this->subscriptions.remove(subscription->getPath(), subscription);
+    else
+        this->patternSubscriptions.removeOne(subscription);
+}
+
+/*
+ * A subscription matches every message whose path ends with the subscribed
+ * path. Instead of asking each subscription, every suffix of the incoming
+ * path starting at a slash is looked up, so a remote trigger such as
+ * /control/<uid>/play reaches its item without visiting any other item.
+ * Subscribers handle the message before this returns, the number of
+ * subscriptions which received it is returned.
+ */
+int OscSubscriptionManager::dispatch(const QString& path, const QList<QVariant>& arguments)
+{
+    int count = 0;
+
+    QList<OscSubscription*> patternSubscriptions;
+    foreach (OscSubscription* subscription, this->patternSubscriptions)
+    {
+        if (path.endsWith(subscription->getPath()))
+            patternSubscriptions.append(subscription);
+    }
+
+    for (int index = path.indexOf('/'); index != -1; index = path.indexOf('/', index + 1))
+    {
+        const QString key = path.mid(index);
+        foreach (OscSubscription* subscription, this->subscriptions.values(key))
+        {
+            // A subscriber may have released another subscription while handling the message.
+            if (this->subscriptions.contains(key, subscription))
+            {
+                emit subscription->subscriptionReceived(key, arguments);
+                count++;
+            }
+        }
+    }
+
+    foreach (OscSubscription* subscription, patternSubscriptions)
+    {
+        if (this->patternSubscriptions.contains(subscription))
+        {
+            emit subscription->subscriptionReceived(subscription->getPath(), arguments);
+            count++;
+        }
+    }
+
+    return count;
+}
+
+void OscSubscriptionManager::messageReceived(const QString& path, const QList<QVariant>& arguments)
+{
+    dispatch(path, arguments);
+}
+
+void OscSubscriptionManager::commandReceived(quint64 ticket, const QString& path, const QList<QVariant>& arguments)
+{
+    int items = dispatch(path, arguments);
+
+    OscWebSocketManager::getInstance().getOscWebSocketListener()->commandExecuted(ticket, items);
+}
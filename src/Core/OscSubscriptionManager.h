@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMultiHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+class OscSubscription;
+
+class CORE_EXPORT OscSubscriptionManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit OscSubscriptionManager();
+
+        static OscSubscriptionManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        void subscribe(OscSubscription* subscription);
+        void unsubscribe(OscSubscription* subscription);
+
+    private:
+        QMultiHash<QString, OscSubscription*> subscriptions;
+        QList<OscSubscription*> patternSubscriptions;
+
+        int dispatch(const QString& path, const QList<QVariant>& arguments);
+
+        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void commandReceived(quint64, const QString&, const QList<QVariant>&);
+};
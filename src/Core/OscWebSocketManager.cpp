@@ -1,5 +1,7 @@
 #include "OscWebSocketManager.h"
 #include "DatabaseManager.h"
+#include "DeviceManager.h"
+#include "StageStateManager.h"
 
 #include <QtCore/QSharedPointer>
 
@@ -20,6 +22,20 @@ void OscWebSocketManager::initialize()
     this->oscWebSocketListener = QSharedPointer<OscWebSocketListener>(new OscWebSocketListener(this));
     if (DatabaseManager::getInstance().getConfigurationByName("EnableOscInput").getValue() == "true")
         this->oscWebSocketListener->start((oscWebSocketPort.isEmpty() == true) ? Osc::DEFAULT_WEBSOCKET_PORT : oscWebSocketPort.toInt());
+
+    QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
+
+    // The device manager is initialized first, so devices added at startup have already been announced.
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(model.getName());
+        if (device != NULL)
+            deviceAdded(*device);
+    }
+    QObject::connect(&StageStateManager::getInstance(), SIGNAL(layerStateChanged(const QString&, const OscLayerModel&)),
+                     this, SLOT(layerStateChanged(const QString&, const OscLayerModel&)));
+    QObject::connect(&StageStateManager::getInstance(), SIGNAL(audioLevelsChanged(const QString&, const QVector<float>&)),
+                     this, SLOT(audioLevelsChanged(const QString&, const QVector<float>&)));
 }
 
 void OscWebSocketManager::uninitialize()
@@ -30,3 +46,41 @@ const QSharedPointer<OscWebSocketListener> OscWebSocketManager::getOscWebSocketL
 {
     return this->oscWebSocketListener;
 }
+
+void OscWebSocketManager::deviceAdded(CasparDevice& device)
+{
+    QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+
+    deviceConnectionStateChanged(device);
+}
+
+void OscWebSocketManager::deviceConnectionStateChanged(CasparDevice& device)
+{
+    const QSharedPointer<DeviceModel> model = DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress());
+    if (model == NULL)
+        return;
+
+    this->oscWebSocketListener->publishState("device", model->getName(), device.isConnected());
+}
+
+void OscWebSocketManager::layerStateChanged(const QString& key, const OscLayerModel& layer)
+{
+    if (!layer.isActive())
+    {
+        this->oscWebSocketListener->publishState("playing", key, QVariant());
+        this->oscWebSocketListener->publishState("time", key, QVariant());
+
+        return;
+    }
+
+    this->oscWebSocketListener->publishState("playing", key, layer.getPath());
+
+    if (layer.getFramesPerSecond() > 0)
+        this->oscWebSocketListener->publishState("time", key, (layer.getTotalFrames() - layer.getFrame()) / layer.getFramesPerSecond());
+}
+
+void OscWebSocketManager::audioLevelsChanged(const QString& key, const QVector<float>& levels)
+{
+    for (int i = 0; i < levels.count(); i++)
+        this->oscWebSocketListener->publishState("audio", QString("%1/mixer/audio/%2").arg(key).arg(i + 1), static_cast<double>(levels.at(i)));
+}
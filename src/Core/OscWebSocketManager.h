@@ -4,8 +4,13 @@
 
 #include "OscWebSocketListener.h"
 
+#include "CasparDevice.h"
+
+#include "Models/OscLayerModel.h"
+
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QVector>
 
 class CORE_EXPORT OscWebSocketManager : public QObject
 {
@@ -23,5 +28,10 @@ class CORE_EXPORT OscWebSocketManager : public QObject
 
     private:
         QSharedPointer<OscWebSocketListener> oscWebSocketListener;
+
+        Q_SLOT void deviceAdded(CasparDevice&);
+        Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void layerStateChanged(const QString&, const OscLayerModel&);
+        Q_SLOT void audioLevelsChanged(const QString&, const QVector<float>&);
 };
 
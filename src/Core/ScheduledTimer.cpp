@@ -0,0 +1,105 @@
+#include "ScheduledTimer.h"
+#include "CommandScheduler.h"
+
+ScheduledTimer::ScheduledTimer(QObject* parent)
+    : QObject(parent),
+      id(0), deadline(0), period(0), singleShot(false), msec(0), frames(-1), framesPerSecond(0)
+{
+}
+
+ScheduledTimer::~ScheduledTimer()
+{
+    stop();
+}
+
+bool ScheduledTimer::isActive() const
+{
+    return this->id != 0;
+}
+
+bool ScheduledTimer::isSingleShot() const
+{
+    return this->singleShot;
+}
+
+void ScheduledTimer::setSingleShot(bool singleShot)
+{
+    this->singleShot = singleShot;
+}
+
+int ScheduledTimer::interval() const
+{
+    return this->msec;
+}
+
+void ScheduledTimer::setInterval(int msec)
+{
+    this->msec = msec;
+    this->frames = -1;
+    this->framesPerSecond = 0;
+    this->clock.clear();
+}
+
+void ScheduledTimer::setFrameInterval(int frames, double framesPerSecond, const QString& clock)
+{
+    if (framesPerSecond <= 0)
+    {
+        setInterval(0);
+        return;
+    }
+
+    this->msec = qRound(frames * 1000 / framesPerSecond);
+    this->frames = frames;
+    this->framesPerSecond = framesPerSecond;
+    this->clock = clock;
+}
+
+void ScheduledTimer::start(int msec)
+{
+    setInterval(msec);
+    start();
+}
+
+void ScheduledTimer::start()
+{
+    stop();
+
+    CommandScheduler& scheduler = CommandScheduler::getInstance();
+
+    qint64 time = scheduler.getStartTime();
+    if (this->frames >= 0)
+    {
+        this->deadline = scheduler.getFrameDeadline(time, this->frames, this->framesPerSecond, this->clock);
+        this->period = qRound64(this->frames * 1000000000.0 / this->framesPerSecond);
+    }
+    else
+    {
+        this->deadline = time + qint64(this->msec) * 1000000;
+        this->period = qint64(this->msec) * 1000000;
+    }
+
+    this->id = scheduler.schedule(this, this->deadline);
+}
+
+void ScheduledTimer::stop()
+{
+    if (this->id == 0)
+        return;
+
+    CommandScheduler::getInstance().cancel(this->id, this->deadline);
+    this->id = 0;
+}
+
+void ScheduledTimer::fire()
+{
+    this->id = 0;
+
+    // A repeating timer is rescheduled from its previous deadline so it does not drift.
+    if (!this->singleShot)
+    {
+        this->deadline += qMax(this->period, qint64(1000000));
+        this->id = CommandScheduler::getInstance().schedule(this, this->deadline);
+    }
+
+    emit timeout();
+}
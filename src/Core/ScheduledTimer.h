@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+/*
+ * Drop-in replacement for QTimer backed by the command scheduler. The interval
+ * can be given in frames, the deadline is then computed from the frame rate
+ * instead of a millisecond interval rounded down once per command.
+ */
+class CORE_EXPORT ScheduledTimer : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit ScheduledTimer(QObject* parent = 0);
+        ~ScheduledTimer();
+
+        bool isActive() const;
+        bool isSingleShot() const;
+        void setSingleShot(bool singleShot);
+
+        int interval() const;
+        void setInterval(int msec);
+        void setFrameInterval(int frames, double framesPerSecond, const QString& clock = QString());
+
+        Q_SLOT void start();
+        Q_SLOT void start(int msec);
+        Q_SLOT void stop();
+
+        Q_SIGNAL void timeout();
+
+    private:
+        quint64 id;
+        qint64 deadline;
+        qint64 period;
+        bool singleShot;
+        int msec;
+        int frames;
+        double framesPerSecond;
+        QString clock;
+
+        void fire();
+
+        friend class CommandScheduler;
+};
@@ -0,0 +1,4 @@
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataUrl', '');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataPollInterval', '1000');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataFile', '');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataUpdateInterval', '200');
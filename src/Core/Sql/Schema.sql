@@ -73,6 +73,7 @@ INSERT INTO Configuration (Name, Value) VALUES('RefreshLibraryInterval', '60');
 INSERT INTO Configuration (Name, Value) VALUES('GpiSerialPort', 'COM1');
 INSERT INTO Configuration (Name, Value) VALUES('GpiBaudRate', '115200');
 INSERT INTO Configuration (Name, Value) VALUES('OscPort', '6250');
+INSERT INTO Configuration (Name, Value) VALUES('OscTcpPort', '6251');
 INSERT INTO Configuration (Name, Value) VALUES('TriCasterPort', '5950');
 INSERT INTO Configuration (Name, Value) VALUES('DelayType', 'Milliseconds');
 INSERT INTO Configuration (Name, Value) VALUES('TriCasterProduct', 'TriCaster 8000');
@@ -81,6 +82,12 @@ INSERT INTO Configuration (Name, Value) VALUES('RundownRepository', '');
 INSERT INTO Configuration (Name, Value) VALUES('RepositoryPort', '8250');
 INSERT INTO Configuration (Name, Value) VALUES('PreviewOnAutoStep', 'false');
 INSERT INTO Configuration (Name, Value) VALUES('ClearDelayedCommandsOnAutoStep', 'false');
+INSERT INTO Configuration (Name, Value) VALUES('PrerollItems', '0');
+INSERT INTO Configuration (Name, Value) VALUES('AutoPlayPretriggerFrames', '0');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataUrl', '');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataPollInterval', '1000');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataFile', '');
+INSERT INTO Configuration (Name, Value) VALUES('LiveDataUpdateInterval', '200');
 INSERT INTO Configuration (Name, Value) VALUES('ShowAudioLevelsPanel', 'true');
 INSERT INTO Configuration (Name, Value) VALUES('ShowPreviewPanel', 'true');
 INSERT INTO Configuration (Name, Value) VALUES('ShowLivePanel', 'true');
@@ -0,0 +1,238 @@
+#include "StageStateManager.h"
+#include "StageStateSubscription.h"
+#include "CommandScheduler.h"
+#include "OscDeviceManager.h"
+
+#include <QtCore/QDateTime>
+#include <QtCore/QStringRef>
+
+Q_GLOBAL_STATIC(StageStateManager, stageStateManager)
+
+static const QString STAGE_LAYER_PATH = "/stage/layer/";
+static const QString MIXER_AUDIO_PATH = "/mixer/audio/";
+static const float SILENT_AUDIO_LEVEL = -192.0f;
+static const int STALE_LAYER_INTERVAL = 500;
+
+StageStateManager::StageStateManager()
+    : notificationScheduled(false)
+{
+}
+
+StageStateManager& StageStateManager::getInstance()
+{
+    return *stageStateManager();
+}
+
+void StageStateManager::initialize()
+{
+    QObject::connect(OscDeviceManager::getInstance().getOscListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&, qint64)));
+    QObject::connect(OscDeviceManager::getInstance().getOscTcpListener().data(), SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&, qint64)));
+
+    QObject::connect(&this->staleTimer, SIGNAL(timeout()), this, SLOT(checkStaleLayers()));
+    this->staleTimer.start(STALE_LAYER_INTERVAL / 2);
+}
+
+void StageStateManager::uninitialize()
+{
+    this->staleTimer.stop();
+}
+
+QString StageStateManager::getLayerKey(const QString& address, int channel, int videolayer)
+{
+    return QString("%1/channel/%2/stage/layer/%3").arg(address).arg(channel).arg(videolayer);
+}
+
+QString StageStateManager::getChannelKey(const QString& address, int channel)
+{
+    return QString("%1/channel/%2").arg(address).arg(channel);
+}
+
+OscLayerModel StageStateManager::getLayerState(const QString& key) const
+{
+    return this->layers.value(key);
+}
+
+QVector<float> StageStateManager::getAudioLevels(const QString& key) const
+{
+    return this->audioLevels.value(key);
+}
+
+void StageStateManager::subscribe(StageStateSubscription* subscription)
+{
+    this->subscriptions.insert(subscription->getKey(), subscription);
+}
+
+void StageStateManager::unsubscribe(StageStateSubscription* subscription)
+{
+    this->subscriptions.remove(subscription->getKey(), subscription);
+}
+
+void StageStateManager::messageReceived(const QString& path, const QList<QVariant>& arguments, qint64 age)
+{
+    processMessage(path, arguments, CommandScheduler::getInstance().getTime() - age);
+}
+
+/*
+ * The OSC path is parsed once here and folded into the state of the addressed
+ * layer or channel. Subscribers are notified once per changed layer or channel
+ * after the current batch has been processed, not once per message.
+ */
+void StageStateManager::processMessage(const QString& path, const QList<QVariant>& arguments, qint64 receipt)
+{
+    if (arguments.isEmpty())
+        return;
+
+    int index = path.indexOf(STAGE_LAYER_PATH);
+    if (index > 0)
+    {
+        int end = path.indexOf('/', index + STAGE_LAYER_PATH.length());
+        if (end < 0)
+            return;
+
+        QString key = path.left(end);
+        QStringRef property = path.midRef(end + 1);
+
+        OscLayerModel& layer = this->layers[key];
+        if (!layer.isActive())
+            layer = OscLayerModel(); // Start over, the previous clip is gone.
+
+        if (property == QLatin1String("file/time"))
+        {
+            layer.setTime(arguments.at(0).toDouble());
+            if (arguments.count() > 1)
+                layer.setTotalTime(arguments.at(1).toDouble());
+        }
+        else if (property == QLatin1String("file/frame"))
+        {
+            layer.setFrame(arguments.at(0).toInt());
+            if (arguments.count() > 1)
+                layer.setTotalFrames(arguments.at(1).toInt());
+
+            layer.setFrameReceipt(receipt);
+
+            // The server reports the frame of every playing layer once per frame of its channel.
+            CommandScheduler::getInstance().updateFrameClock(path.left(index), receipt);
+        }
+        else if (property == QLatin1String("file/fps"))
+            layer.setFramesPerSecond(arguments.at(0).toDouble());
+        else if (property == QLatin1String("file/path"))
+            layer.setPath(arguments.at(0).toString());
+        else if (property == QLatin1String("paused"))
+            layer.setPaused(arguments.at(0).toBool());
+        else if (property == QLatin1String("loop"))
+            layer.setLoop(arguments.at(0).toBool());
+        else
+            return;
+
+        layer.setActive(true);
+        layer.setTimestamp(QDateTime::currentMSecsSinceEpoch());
+
+        this->activeLayers.insert(key);
+        this->changedLayers.insert(key);
+
+        scheduleNotification();
+
+        return;
+    }
+
+    index = path.indexOf(MIXER_AUDIO_PATH);
+    if (index > 0)
+    {
+        QString key = path.left(index);
+        QStringRef property = path.midRef(index + MIXER_AUDIO_PATH.length());
+
+        QVector<float>& levels = this->audioLevels[key];
+        if (property == QLatin1String("nb_channels"))
+        {
+            int count = arguments.at(0).toInt();
+            if (count < 0 || count == levels.count())
+                return;
+
+            levels.fill(SILENT_AUDIO_LEVEL, count);
+        }
+        else if (property.endsWith(QLatin1String("/dBFS")))
+        {
+            int audioChannel = property.left(property.indexOf('/')).toInt();
+            if (audioChannel < 1)
+                return;
+
+            while (levels.count() < audioChannel)
+                levels.append(SILENT_AUDIO_LEVEL);
+
+            levels[audioChannel - 1] = arguments.at(0).toFloat();
+        }
+        else
+            return;
+
+        this->changedChannels.insert(key);
+
+        scheduleNotification();
+    }
+}
+
+void StageStateManager::scheduleNotification()
+{
+    if (this->notificationScheduled)
+        return;
+
+    this->notificationScheduled = true;
+    QTimer::singleShot(0, this, SLOT(notifySubscribers()));
+}
+
+void StageStateManager::notifySubscribers()
+{
+    this->notificationScheduled = false;
+
+    QSet<QString> layerKeys;
+    QSet<QString> channelKeys;
+    layerKeys.swap(this->changedLayers);
+    channelKeys.swap(this->changedChannels);
+
+    foreach (const QString& key, layerKeys)
+    {
+        const OscLayerModel layer = this->layers.value(key);
+        emit layerStateChanged(key, layer);
+
+        foreach (StageStateSubscription* subscription, this->subscriptions.values(key))
+        {
+            // A subscriber may have released another subscription while handling the notification.
+            if (this->subscriptions.contains(key, subscription))
+                emit subscription->layerChanged(layer);
+        }
+    }
+
+    foreach (const QString& key, channelKeys)
+    {
+        const QVector<float> levels = this->audioLevels.value(key);
+        emit audioLevelsChanged(key, levels);
+
+        foreach (StageStateSubscription* subscription, this->subscriptions.values(key))
+        {
+            if (this->subscriptions.contains(key, subscription))
+                emit subscription->audioChanged(levels);
+        }
+    }
+}
+
+void StageStateManager::checkStaleLayers()
+{
+    qint64 timestamp = QDateTime::currentMSecsSinceEpoch();
+
+    foreach (const QString& key, this->activeLayers)
+    {
+        OscLayerModel& layer = this->layers[key];
+        if (timestamp - layer.getTimestamp() < STALE_LAYER_INTERVAL)
+            continue;
+
+        // The server stops sending file information when the layer is cleared.
+        layer.setActive(false);
+
+        this->activeLayers.remove(key);
+        this->changedLayers.insert(key);
+    }
+
+    if (!this->changedLayers.isEmpty())
+        scheduleNotification();
+}
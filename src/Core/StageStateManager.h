@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/OscLayerModel.h"
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QMultiHash>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+class StageStateSubscription;
+
+class CORE_EXPORT StageStateManager : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit StageStateManager();
+
+        static StageStateManager& getInstance();
+
+        void initialize();
+        void uninitialize();
+
+        static QString getLayerKey(const QString& address, int channel, int videolayer);
+        static QString getChannelKey(const QString& address, int channel);
+
+        OscLayerModel getLayerState(const QString& key) const;
+        QVector<float> getAudioLevels(const QString& key) const;
+
+        void subscribe(StageStateSubscription* subscription);
+        void unsubscribe(StageStateSubscription* subscription);
+
+        Q_SIGNAL void layerStateChanged(const QString&, const OscLayerModel&);
+        Q_SIGNAL void audioLevelsChanged(const QString&, const QVector<float>&);
+
+    private:
+        QTimer staleTimer;
+        bool notificationScheduled;
+
+        QHash<QString, OscLayerModel> layers;
+        QHash<QString, QVector<float>> audioLevels;
+        QSet<QString> activeLayers;
+        QSet<QString> changedLayers;
+        QSet<QString> changedChannels;
+        QMultiHash<QString, StageStateSubscription*> subscriptions;
+
+        void processMessage(const QString& path, const QList<QVariant>& arguments, qint64 receipt);
+        void scheduleNotification();
+
+        Q_SLOT void messageReceived(const QString&, const QList<QVariant>&, qint64);
+        Q_SLOT void notifySubscribers();
+        Q_SLOT void checkStaleLayers();
+};
@@ -0,0 +1,19 @@
+#include "StageStateSubscription.h"
+#include "StageStateManager.h"
+
+StageStateSubscription::StageStateSubscription(const QString& key, QObject* parent)
+    : QObject(parent),
+      key(key)
+{
+    StageStateManager::getInstance().subscribe(this);
+}
+
+StageStateSubscription::~StageStateSubscription()
+{
+    StageStateManager::getInstance().unsubscribe(this);
+}
+
+const QString& StageStateSubscription::getKey() const
+{
+    return this->key;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Shared.h"
+
+#include "Models/OscLayerModel.h"
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+class CORE_EXPORT StageStateSubscription : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit StageStateSubscription(const QString& key, QObject* parent = 0);
+        ~StageStateSubscription();
+
+        const QString& getKey() const;
+
+        Q_SIGNAL void layerChanged(const OscLayerModel&);
+        Q_SIGNAL void audioChanged(const QVector<float>&);
+
+    private:
+        QString key;
+};
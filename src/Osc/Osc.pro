@@ -11,13 +11,21 @@ HEADERS += \
     Shared.h \
     OscThread.h \
     OscListener.h \
+    OscRecorder.h \
+    OscReplayer.h \
     OscSender.h \
+    OscStallWatchdog.h \
+    OscTcpListener.h \
     OscWebSocketListener.h
 
 SOURCES += \
     OscThread.cpp \
     OscListener.cpp \
+    OscRecorder.cpp \
+    OscReplayer.cpp \
     OscSender.cpp \
+    OscStallWatchdog.cpp \
+    OscTcpListener.cpp \
     OscWebSocketListener.cpp
 
 CONFIG(system-boost) {
@@ -1,4 +1,5 @@
 #include "OscListener.h"
+#include "OscReplayer.h"
 
 #include <QtCore/QString>
 #include <QtCore/QThread>
@@ -12,6 +13,7 @@ OscListener::OscListener(const QString& address, int port, QObject* parent)
     try
     {
         this->port = port;
+        this->clock.start();
 
         this->socket = new UdpSocket();
         this->socket->SetAllowReuse(true);
@@ -50,6 +52,40 @@ void OscListener::start()
         this->thread->start();
 }
 
+bool OscListener::startRecording(const QString& path)
+{
+    return this->recorder.open(path);
+}
+
+void OscListener::stopRecording()
+{
+    this->recorder.close();
+}
+
+OscListener::Statistics OscListener::getStatistics()
+{
+    QMutexLocker locker(&eventsMutex);
+
+    return this->statistics;
+}
+
+void OscListener::resetStatistics()
+{
+    QMutexLocker locker(&eventsMutex);
+
+    this->statistics = Statistics();
+}
+
+void OscListener::ProcessPacket(const char* data, int size, const IpEndpointName& endpoint)
+{
+    // All messages of a bundle share the time the packet was received.
+    this->packetReceipt = this->clock.nsecsElapsed();
+
+    this->recorder.write(data, size, endpoint.address, endpoint.port);
+
+    osc::OscPacketListener::ProcessPacket(data, size, endpoint);
+}
+
 void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint)
 {
     char addressBuffer[256];
@@ -80,29 +116,81 @@ void OscListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEn
 
     //qDebug("DEBUG: OSC message received: %s", eventPath);
 
+    // A replay is measured from its start, the markers themselves are not counted. Only a
+    // replay on this host may reset the statistics, oscreplay runs next to the client.
+    bool loopback = ((endpoint.address >> 24) == 127);
+    if (loopback && eventMessage == OscReplayer::STARTED_ADDRESS)
+    {
+        resetStatistics();
+        emit replayStarted();
+
+        return;
+    }
+    else if (loopback && eventMessage == OscReplayer::FINISHED_ADDRESS)
+    {
+        {
+            QMutexLocker locker(&eventsMutex);
+            this->statistics.sentMessages = arguments.isEmpty() ? 0 : arguments.at(0).toULongLong();
+        }
+
+        emit replayFinished();
+
+        return;
+    }
+
+    qint64 receipt = this->packetReceipt;
+
     QMutexLocker locker(&eventsMutex);
+    this->statistics.receivedMessages++;
+
+    // Latency is measured from the first arrival of a path not yet dispatched.
+    if (!this->arrivals.contains(eventPath))
+        this->arrivals[eventPath] = receipt / 1000;
+
     if (eventMessage.startsWith("/control"))
     {
         qDebug("Received OSC message from %s:%d: %s", qPrintable(addressBuffer), this->port, qPrintable(eventMessage));
 
         // Do not overwrite control commands already in queue.
-        if (!this->events.contains(eventPath))
-            this->events[eventPath] = arguments;
+        if (this->events.contains(eventPath))
+            return;
     }
-    else
-        this->events[eventPath] = arguments;
+
+    this->events[eventPath] = arguments;
+    this->receipts[eventPath] = receipt;
 }
 
 void OscListener::sendEventBatch()
 {
     QMap<QString, QList<QVariant>> other;
+    QMap<QString, qint64> arrived;
+    QMap<QString, qint64> received;
     {
         QMutexLocker locker(&eventsMutex);
         this->events.swap(other);
+        this->arrivals.swap(arrived);
+        this->receipts.swap(received);
     }
 
+    qint64 maxLatency = 0;
+    qint64 totalLatency = 0;
     foreach (const QString& eventPath, other.keys())
-        emit messageReceived(eventPath, other[eventPath]);
+    {
+        // Receivers do not share our clock, so the time of receipt is handed over as the age of the message.
+        emit messageReceived(eventPath, other[eventPath], this->clock.nsecsElapsed() - received.value(eventPath));
+
+        qint64 latency = this->clock.nsecsElapsed() / 1000 - arrived.value(eventPath);
+        maxLatency = qMax(maxLatency, latency);
+        totalLatency += latency;
+    }
+
+    if (!other.isEmpty())
+    {
+        QMutexLocker locker(&eventsMutex);
+        this->statistics.dispatchedMessages += other.count();
+        this->statistics.maxDispatchLatency = qMax(this->statistics.maxDispatchLatency, maxLatency);
+        this->statistics.totalDispatchLatency += totalLatency;
+    }
 
     QTimer::singleShot(200, this, SLOT(sendEventBatch()));
 }
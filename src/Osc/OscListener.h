@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Shared.h"
+#include "OscRecorder.h"
 #include "OscThread.h"
 
 #include <osc/OscReceivedElements.h>
@@ -8,6 +9,7 @@
 #include <ip/UdpSocket.h>
 
 #include <QtCore/QObject>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QMap>
 #include <QtCore/QVariant>
 #include <QtCore/QMutex>
@@ -20,17 +22,41 @@ class OSC_EXPORT OscListener : public QObject, public osc::OscPacketListener
         explicit OscListener(const QString& address, int port, QObject* parent = 0);
         ~OscListener();
 
+        struct Statistics
+        {
+            quint64 receivedMessages = 0;
+            quint64 dispatchedMessages = 0;
+            qint64 maxDispatchLatency = 0;
+            qint64 totalDispatchLatency = 0;
+            quint64 sentMessages = 0; // Reported at the end of a replay.
+        };
+
         void start();
 
-        Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
+        bool startRecording(const QString& path);
+        void stopRecording();
+
+        Statistics getStatistics();
+        void resetStatistics();
+
+        Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&, qint64);
+        Q_SIGNAL void replayStarted();
+        Q_SIGNAL void replayFinished();
 
     protected:
+        virtual void ProcessPacket(const char* data, int size, const IpEndpointName& endpoint);
         virtual void ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint);
 
     private:
         int port;
         QMutex eventsMutex;
         QMap<QString, QList<QVariant>> events;
+        QMap<QString, qint64> arrivals;
+        QMap<QString, qint64> receipts;
+        qint64 packetReceipt = 0;
+        QElapsedTimer clock;
+        Statistics statistics;
+        OscRecorder recorder;
         OscThread* thread = nullptr;
         UdpSocket* socket = nullptr;
         SocketReceiveMultiplexer* multiplexer = nullptr;
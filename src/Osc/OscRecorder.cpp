@@ -0,0 +1,87 @@
+#include "OscRecorder.h"
+
+#include <QtCore/QMutexLocker>
+
+OscRecorder::OscRecorder()
+{
+}
+
+OscRecorder::~OscRecorder()
+{
+    close();
+}
+
+bool OscRecorder::open(const QString& path)
+{
+    QMutexLocker locker(&this->mutex);
+
+    if (this->file.isOpen())
+        this->file.close();
+
+    this->file.setFileName(path);
+    if (!this->file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("Unable to open OSC recording %s: %s", qPrintable(path), qPrintable(this->file.errorString()));
+        return false;
+    }
+
+    this->stream.setDevice(&this->file);
+    this->stream.setByteOrder(QDataStream::BigEndian);
+    this->stream << OscRecorder::MAGIC << OscRecorder::VERSION;
+
+    this->packets = 0;
+    this->lastTimestamp = 0;
+    this->clock.start();
+
+    qDebug("Recording incoming OSC datagrams to %s", qPrintable(path));
+
+    return true;
+}
+
+void OscRecorder::close()
+{
+    QMutexLocker locker(&this->mutex);
+
+    if (!this->file.isOpen())
+        return;
+
+    this->stream.setDevice(nullptr);
+    this->file.close();
+
+    qDebug("Stopped OSC recording after %llu datagrams", this->packets);
+}
+
+bool OscRecorder::isOpen()
+{
+    QMutexLocker locker(&this->mutex);
+
+    return this->file.isOpen();
+}
+
+void OscRecorder::write(const char* data, int size, unsigned long address, int port)
+{
+    // Larger datagrams cannot be produced over UDP anyway.
+    if (size <= 0 || size > 0xFFFF)
+        return;
+
+    QMutexLocker locker(&this->mutex);
+
+    if (!this->file.isOpen())
+        return;
+
+    qint64 timestamp = this->clock.nsecsElapsed() / 1000;
+    qint64 delta = qMin<qint64>(timestamp - this->lastTimestamp, 0xFFFFFFFF);
+    this->lastTimestamp = timestamp;
+
+    this->stream << static_cast<quint32>(delta) << static_cast<quint32>(address) << static_cast<quint16>(port) << static_cast<quint16>(size);
+    this->stream.writeRawData(data, size);
+
+    this->packets++;
+}
+
+quint64 OscRecorder::getPacketCount()
+{
+    QMutexLocker locker(&this->mutex);
+
+    return this->packets;
+}
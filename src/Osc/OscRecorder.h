@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+/*
+ * Records raw OSC datagrams to a compact file which can be fed back
+ * with OscReplayer. All values are big-endian:
+ *
+ *   header: "OSCR" quint16 version
+ *   record: quint32 delta (microseconds since previous record)
+ *           quint32 IPv4 address, quint16 port
+ *           quint16 size, size bytes of datagram
+ */
+class OSC_EXPORT OscRecorder
+{
+    public:
+        explicit OscRecorder();
+        ~OscRecorder();
+
+        static const quint32 MAGIC = 0x4F534352;
+        static const quint16 VERSION = 1;
+
+        bool open(const QString& path);
+        void close();
+        bool isOpen();
+
+        void write(const char* data, int size, unsigned long address, int port);
+
+        quint64 getPacketCount();
+
+    private:
+        QMutex mutex;
+        QFile file;
+        QDataStream stream;
+        QElapsedTimer clock;
+        qint64 lastTimestamp = 0;
+        quint64 packets = 0;
+};
@@ -0,0 +1,305 @@
+#include "OscReplayer.h"
+#include "OscRecorder.h"
+
+#include <ip/UdpSocket.h>
+#include <osc/OscOutboundPacketStream.h>
+
+#include <stdexcept>
+
+#include <QtCore/QDataStream>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QScopedPointer>
+
+#include <QtNetwork/QTcpSocket>
+
+// SLIP framing as specified by OSC 1.1 (RFC 1055 double-END variant).
+static const char SLIP_END = '\xC0';
+static const char SLIP_ESC = '\xDB';
+static const char SLIP_ESC_END = '\xDC';
+static const char SLIP_ESC_ESC = '\xDD';
+
+static const int TCP_TIMEOUT = 5000;
+static const int MAX_TCP_PENDING_BYTES = 65536;
+
+const char* const OscReplayer::STARTED_ADDRESS = "/oscreplay/started";
+const char* const OscReplayer::FINISHED_ADDRESS = "/oscreplay/finished";
+
+OscReplayer::OscReplayer(QObject* parent)
+    : QThread(parent)
+{
+}
+
+bool OscReplayer::load(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("Unable to open OSC recording %s: %s", qPrintable(path), qPrintable(file.errorString()));
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::BigEndian);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    stream >> magic >> version;
+    if (magic != OscRecorder::MAGIC || version != OscRecorder::VERSION)
+    {
+        qWarning("%s is not a supported OSC recording", qPrintable(path));
+        return false;
+    }
+
+    // Everything is kept in memory so disk access never disturbs the timing.
+    this->packets.clear();
+    this->messages = 0;
+
+    qint64 timestamp = 0;
+    while (!stream.atEnd())
+    {
+        quint32 delta, address;
+        quint16 port, size;
+        stream >> delta >> address >> port >> size;
+
+        Packet packet;
+        packet.data.resize(size);
+        if (stream.readRawData(packet.data.data(), size) != size || stream.status() != QDataStream::Ok)
+        {
+            qWarning("OSC recording %s is truncated after %d datagrams", qPrintable(path), this->packets.count());
+            break;
+        }
+
+        timestamp += delta;
+        packet.timestamp = timestamp;
+
+        try
+        {
+            packet.messages = OscReplayer::countMessages(osc::ReceivedPacket(packet.data.constData(), packet.data.size()));
+        }
+        catch (osc::Exception&)
+        {
+            packet.messages = 0;
+        }
+
+        this->messages += packet.messages;
+        this->packets.append(packet);
+    }
+
+    return true;
+}
+
+void OscReplayer::setTarget(const QString& address, int port)
+{
+    this->address = address;
+    this->port = port;
+}
+
+void OscReplayer::setSpeed(double speed)
+{
+    this->speed = speed;
+}
+
+void OscReplayer::setTcp(bool tcp)
+{
+    this->tcp = tcp;
+}
+
+void OscReplayer::stop()
+{
+    this->stopped.store(1);
+}
+
+int OscReplayer::getPacketCount() const
+{
+    return this->packets.count();
+}
+
+quint64 OscReplayer::getMessageCount() const
+{
+    return this->messages;
+}
+
+qint64 OscReplayer::getDuration() const
+{
+    return this->packets.isEmpty() ? 0 : this->packets.last().timestamp / 1000;
+}
+
+quint64 OscReplayer::getSentPackets() const
+{
+    return this->sentPackets.load();
+}
+
+quint64 OscReplayer::getSentMessages() const
+{
+    return this->sentMessages.load();
+}
+
+qint64 OscReplayer::getElapsed() const
+{
+    return this->elapsed.load();
+}
+
+qint64 OscReplayer::getMaxLateness() const
+{
+    return this->maxLateness.load();
+}
+
+void OscReplayer::run()
+{
+    this->stopped.store(0);
+    this->sentPackets.store(0);
+    this->sentMessages.store(0);
+    this->maxLateness.store(0);
+
+    try
+    {
+        QScopedPointer<UdpTransmitSocket> udpSocket;
+        QScopedPointer<QTcpSocket> tcpSocket;
+        if (this->tcp)
+        {
+            tcpSocket.reset(new QTcpSocket());
+            tcpSocket->connectToHost(this->address, this->port);
+            if (!tcpSocket->waitForConnected(TCP_TIMEOUT))
+            {
+                qWarning("Unable to connect to %s:%d: %s", qPrintable(this->address), this->port, qPrintable(tcpSocket->errorString()));
+                return;
+            }
+
+            tcpSocket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+        }
+        else
+            udpSocket.reset(new UdpTransmitSocket(IpEndpointName(this->address.toStdString().c_str(), this->port)));
+
+        this->udpSocket = udpSocket.data();
+        this->tcpSocket = tcpSocket.data();
+
+        sendMarker(OscReplayer::STARTED_ADDRESS, this->messages);
+
+        QElapsedTimer clock;
+        clock.start();
+
+        foreach (const Packet& packet, this->packets)
+        {
+            if (this->stopped.load())
+                break;
+
+            if (this->speed > 0)
+            {
+                qint64 target = static_cast<qint64>(packet.timestamp / this->speed);
+                qint64 now = clock.nsecsElapsed() / 1000;
+
+                // Sleep for the bulk of the gap and spin the last millisecond.
+                while (now < target && !this->stopped.load())
+                {
+                    if (target - now > 2000)
+                        QThread::usleep(target - now - 1000);
+                    else
+                        QThread::yieldCurrentThread();
+
+                    now = clock.nsecsElapsed() / 1000;
+                }
+
+                if (now - target > this->maxLateness.load())
+                    this->maxLateness.store(now - target);
+            }
+
+            send(packet.data.constData(), packet.data.size());
+
+            this->sentPackets.fetchAndAddRelaxed(1);
+            this->sentMessages.fetchAndAddRelaxed(packet.messages);
+        }
+
+        this->elapsed.store(clock.elapsed());
+
+        sendMarker(OscReplayer::FINISHED_ADDRESS, this->sentMessages.load());
+
+        if (this->tcpSocket != nullptr)
+        {
+            while (this->tcpSocket->bytesToWrite() > 0)
+            {
+                if (!this->tcpSocket->waitForBytesWritten(TCP_TIMEOUT))
+                    break;
+            }
+
+            this->tcpSocket->disconnectFromHost();
+        }
+    }
+    catch (std::runtime_error& e)
+    {
+        qWarning("%s", qPrintable(QString::fromStdString(e.what()).trimmed()));
+    }
+
+    this->udpSocket = nullptr;
+    this->tcpSocket = nullptr;
+}
+
+void OscReplayer::send(const char* data, int size)
+{
+    if (this->udpSocket != nullptr)
+    {
+        this->udpSocket->Send(data, size);
+        return;
+    }
+
+    this->tcpSocket->write(OscReplayer::encodeSlip(data, size));
+
+    // Block while the listener lags behind, the way a client is held back by the TCP window.
+    while (this->tcpSocket->bytesToWrite() > MAX_TCP_PENDING_BYTES && !this->stopped.load())
+    {
+        if (!this->tcpSocket->waitForBytesWritten(TCP_TIMEOUT))
+            break;
+    }
+}
+
+void OscReplayer::sendMarker(const char* address, qint64 value)
+{
+    char buffer[256];
+    osc::OutboundPacketStream stream(buffer, sizeof(buffer));
+    stream << osc::BeginMessage(address) << static_cast<osc::int64>(value) << osc::EndMessage;
+
+    send(stream.Data(), stream.Size());
+}
+
+QByteArray OscReplayer::encodeSlip(const char* data, int size)
+{
+    QByteArray frame;
+    frame.reserve(size + 2);
+    frame.append(SLIP_END);
+
+    for (int i = 0; i < size; i++)
+    {
+        if (data[i] == SLIP_END)
+            frame.append(SLIP_ESC).append(SLIP_ESC_END);
+        else if (data[i] == SLIP_ESC)
+            frame.append(SLIP_ESC).append(SLIP_ESC_ESC);
+        else
+            frame.append(data[i]);
+    }
+
+    frame.append(SLIP_END);
+
+    return frame;
+}
+
+int OscReplayer::countMessages(const osc::ReceivedPacket& packet)
+{
+    if (packet.IsBundle())
+        return OscReplayer::countMessages(osc::ReceivedBundle(packet));
+
+    return 1;
+}
+
+int OscReplayer::countMessages(const osc::ReceivedBundle& bundle)
+{
+    int count = 0;
+    for (osc::ReceivedBundle::const_iterator iterator = bundle.ElementsBegin(); iterator != bundle.ElementsEnd(); ++iterator)
+    {
+        if (iterator->IsBundle())
+            count += OscReplayer::countMessages(osc::ReceivedBundle(*iterator));
+        else
+            count++;
+    }
+
+    return count;
+}
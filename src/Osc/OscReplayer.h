@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <osc/OscReceivedElements.h>
+
+#include <QtCore/QAtomicInteger>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+
+class QTcpSocket;
+class UdpTransmitSocket;
+
+/*
+ * Sends the datagrams of a recording made by OscRecorder to a UDP target,
+ * preserving the recorded timing divided by the speed factor. A speed of
+ * zero sends as fast as the socket allows. The replay is framed by two
+ * messages of its own, so a listener can report what it missed. Over TCP
+ * every datagram is sent as a SLIP frame, the way OscTcpListener reads them.
+ */
+class OSC_EXPORT OscReplayer : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit OscReplayer(QObject* parent = 0);
+
+        static const char* const STARTED_ADDRESS;
+        static const char* const FINISHED_ADDRESS;
+
+        bool load(const QString& path);
+
+        void setTarget(const QString& address, int port);
+        void setSpeed(double speed);
+        void setTcp(bool tcp);
+        void stop();
+
+        int getPacketCount() const;
+        quint64 getMessageCount() const;
+        qint64 getDuration() const;
+
+        quint64 getSentPackets() const;
+        quint64 getSentMessages() const;
+        qint64 getElapsed() const;
+        qint64 getMaxLateness() const;
+
+    protected:
+        void run();
+
+    private:
+        struct Packet
+        {
+            qint64 timestamp = 0;
+            int messages = 0;
+            QByteArray data;
+        };
+
+        QString address;
+        int port = 0;
+        double speed = 1;
+        bool tcp = false;
+
+        UdpTransmitSocket* udpSocket = nullptr;
+        QTcpSocket* tcpSocket = nullptr;
+
+        QList<Packet> packets;
+        quint64 messages = 0;
+
+        QAtomicInteger<int> stopped;
+        QAtomicInteger<quint64> sentPackets;
+        QAtomicInteger<quint64> sentMessages;
+        QAtomicInteger<qint64> elapsed;
+        QAtomicInteger<qint64> maxLateness;
+
+        void send(const char* data, int size);
+        void sendMarker(const char* address, qint64 value);
+
+        static QByteArray encodeSlip(const char* data, int size);
+        static int countMessages(const osc::ReceivedPacket& packet);
+        static int countMessages(const osc::ReceivedBundle& bundle);
+};
@@ -0,0 +1,51 @@
+#include "OscStallWatchdog.h"
+
+// Interval of the watchdog, anything beyond it counts as stall.
+static const int WATCHDOG_INTERVAL = 5;
+
+OscStallWatchdog::OscStallWatchdog(QObject* parent)
+    : QObject(parent)
+{
+    this->timer.setInterval(WATCHDOG_INTERVAL);
+    this->timer.setTimerType(Qt::PreciseTimer);
+
+    QObject::connect(&this->timer, SIGNAL(timeout()), this, SLOT(tick()));
+}
+
+void OscStallWatchdog::start()
+{
+    this->lastTick = 0;
+    this->maxStall = 0;
+    this->totalStall = 0;
+
+    this->clock.start();
+    this->timer.start();
+}
+
+void OscStallWatchdog::stop()
+{
+    this->timer.stop();
+}
+
+qint64 OscStallWatchdog::getMaxStall() const
+{
+    return this->maxStall;
+}
+
+qint64 OscStallWatchdog::getTotalStall() const
+{
+    return this->totalStall;
+}
+
+void OscStallWatchdog::tick()
+{
+    qint64 now = this->clock.nsecsElapsed() / 1000;
+    qint64 stall = now - this->lastTick - WATCHDOG_INTERVAL * 1000;
+    this->lastTick = now;
+
+    if (stall > 0)
+    {
+        this->maxStall = qMax(this->maxStall, stall);
+        this->totalStall += stall;
+    }
+}
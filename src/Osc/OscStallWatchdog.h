@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+/*
+ * Measures how long the thread it lives in is kept from running its event
+ * loop while OSC is replayed into it. A precise timer ticks every few
+ * milliseconds, any time a tick is late counts as stall.
+ */
+class OSC_EXPORT OscStallWatchdog : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit OscStallWatchdog(QObject* parent = 0);
+
+        void start();
+        void stop();
+
+        qint64 getMaxStall() const;
+        qint64 getTotalStall() const;
+
+    private:
+        QTimer timer;
+        QElapsedTimer clock;
+        qint64 lastTick = 0;
+        qint64 maxStall = 0;
+        qint64 totalStall = 0;
+
+        Q_SLOT void tick();
+};
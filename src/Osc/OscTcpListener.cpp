@@ -0,0 +1,344 @@
+#include "OscTcpListener.h"
+
+#include <osc/OscException.h>
+
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+#include <QtCore/QDebug>
+
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+
+// SLIP framing as specified by OSC 1.1 (RFC 1055 double-END variant).
+static const char SLIP_END = '\xC0';
+static const char SLIP_ESC = '\xDB';
+static const char SLIP_ESC_END = '\xDC';
+static const char SLIP_ESC_ESC = '\xDD';
+
+static const int MAX_PACKET_SIZE = 65536;
+static const int READ_BUFFER_SIZE = 65536;
+static const int MAX_PENDING_PACKETS = 1024;
+static const int MAX_PACKETS_PER_DISPATCH = 256;
+static const int STATISTICS_INTERVAL = 1000;
+
+OscTcpListener::OscTcpListener(QObject* parent)
+    : QObject(parent)
+{
+    this->clock.start();
+}
+
+OscTcpListener::~OscTcpListener()
+{
+    if (this->server != nullptr)
+        this->server->close();
+
+    foreach (Client* client, this->clients)
+    {
+        client->socket->disconnect(this);
+        delete client->socket;
+    }
+
+    qDeleteAll(this->clients);
+}
+
+void OscTcpListener::start(int port)
+{
+    this->server = new QTcpServer(this);
+    if (this->server->listen(QHostAddress::Any, port))
+    {
+        qDebug("Listening for incoming OSC messages over TCP on port %d", port);
+
+        QObject::connect(this->server, SIGNAL(newConnection()), this, SLOT(newConnection()));
+
+        this->statisticsClock.start();
+        this->statisticsTimer = new QTimer(this);
+        this->statisticsTimer->setInterval(STATISTICS_INTERVAL);
+        QObject::connect(this->statisticsTimer, SIGNAL(timeout()), this, SLOT(updateStatistics()));
+        this->statisticsTimer->start();
+    }
+    else
+    {
+        qWarning("Unable to listen on port %d", port);
+    }
+}
+
+bool OscTcpListener::isListening() const
+{
+    return this->server != nullptr && this->server->isListening();
+}
+
+QList<OscTcpListener::ClientStatistics> OscTcpListener::getClientStatistics() const
+{
+    QList<ClientStatistics> statistics;
+    foreach (const Client* client, this->clients)
+        statistics.append(client->statistics);
+
+    return statistics;
+}
+
+void OscTcpListener::newConnection()
+{
+    while (this->server->hasPendingConnections())
+    {
+        QTcpSocket* socket = this->server->nextPendingConnection();
+
+        // Bound the amount Qt buffers on our behalf, once a client is throttled the
+        // kernel receive window fills up and the sender is blocked by TCP itself.
+        socket->setReadBufferSize(READ_BUFFER_SIZE);
+        socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+
+        Client* client = new Client();
+        client->socket = socket;
+        client->ipAddress = socket->peerAddress().toIPv4Address();
+        client->port = socket->peerPort();
+        client->statistics.address = QString("%1:%2").arg(socket->peerAddress().toString()).arg(socket->peerPort());
+
+        qDebug("Accepted OSC TCP connection from %s", qPrintable(client->statistics.address));
+
+        QObject::connect(socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
+        QObject::connect(socket, SIGNAL(readyRead()), this, SLOT(readyRead()));
+
+        this->clients.insert(socket, client);
+    }
+}
+
+void OscTcpListener::disconnected()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(QObject::sender());
+    if (socket == nullptr || !this->clients.contains(socket))
+        return;
+
+    Client* client = this->clients.value(socket);
+
+    // Deliver everything the client managed to send before it went away.
+    decodeSlip(client, socket->readAll(), this->clock.nsecsElapsed());
+    while (!client->packets.isEmpty())
+        dispatchPacket(client, client->packets.dequeue());
+
+    qDebug("OSC TCP client %s was disconnected after %llu messages (%llu dropped)",
+           qPrintable(client->statistics.address), client->statistics.messages, client->statistics.droppedPackets);
+
+    // Last chance to read the final counters of the client.
+    emit statisticsUpdated();
+
+    this->clients.remove(socket);
+    delete client;
+
+    socket->deleteLater();
+}
+
+void OscTcpListener::readyRead()
+{
+    QTcpSocket* socket = qobject_cast<QTcpSocket*>(QObject::sender());
+    if (socket == nullptr || !this->clients.contains(socket))
+        return;
+
+    readClient(this->clients.value(socket));
+}
+
+void OscTcpListener::readClient(Client* client)
+{
+    if (client->packets.count() >= MAX_PENDING_PACKETS)
+    {
+        // Leave the data in the socket, we resume reading once the queue has drained.
+        client->throttled = true;
+        return;
+    }
+
+    QByteArray data = client->socket->readAll();
+    if (data.isEmpty())
+        return;
+
+    // Packets are stamped when they are read, not when they are dispatched.
+    qint64 receipt = this->clock.nsecsElapsed();
+
+    client->statistics.bytes += data.size();
+
+    decodeSlip(client, data, receipt);
+    scheduleDispatch();
+}
+
+void OscTcpListener::decodeSlip(Client* client, const QByteArray& data, qint64 receipt)
+{
+    const char* bytes = data.constData();
+    for (int i = 0; i < data.size(); i++)
+    {
+        const char byte = bytes[i];
+
+        if (byte == SLIP_END)
+        {
+            if (!client->discarding && !client->frame.isEmpty())
+            {
+                Packet packet;
+                packet.data = client->frame;
+                packet.receipt = receipt;
+                client->packets.enqueue(packet);
+            }
+
+            client->frame.clear();
+            client->escaped = false;
+            client->discarding = false;
+
+            continue;
+        }
+
+        if (client->discarding)
+            continue;
+
+        if (client->escaped)
+        {
+            client->escaped = false;
+
+            if (byte == SLIP_ESC_END)
+                client->frame.append(SLIP_END);
+            else if (byte == SLIP_ESC_ESC)
+                client->frame.append(SLIP_ESC);
+            else
+            {
+                qWarning("Invalid SLIP escape sequence received from %s", qPrintable(client->statistics.address));
+
+                client->statistics.droppedPackets++;
+                client->discarding = true;
+            }
+        }
+        else if (byte == SLIP_ESC)
+            client->escaped = true;
+        else
+            client->frame.append(byte);
+
+        if (client->frame.size() > MAX_PACKET_SIZE)
+        {
+            qWarning("OSC packet from %s exceeds %d bytes, discarding", qPrintable(client->statistics.address), MAX_PACKET_SIZE);
+
+            client->statistics.droppedPackets++;
+            client->frame.clear();
+            client->discarding = true;
+        }
+    }
+}
+
+void OscTcpListener::scheduleDispatch()
+{
+    if (this->dispatchScheduled)
+        return;
+
+    this->dispatchScheduled = true;
+    QTimer::singleShot(0, this, SLOT(dispatchPackets()));
+}
+
+void OscTcpListener::dispatchPackets()
+{
+    this->dispatchScheduled = false;
+
+    // Round robin between the clients so one busy sender can not starve the others, and
+    // bound the work per event loop iteration to keep the GUI responsive during bursts.
+    int budget = MAX_PACKETS_PER_DISPATCH;
+    bool pending = true;
+    while (budget > 0 && pending)
+    {
+        pending = false;
+        foreach (QTcpSocket* socket, this->clients.keys())
+        {
+            Client* client = this->clients.value(socket);
+            if (client == nullptr || client->packets.isEmpty())
+                continue;
+
+            dispatchPacket(client, client->packets.dequeue());
+
+            pending = pending || !client->packets.isEmpty();
+            if (--budget == 0)
+                break;
+        }
+    }
+
+    foreach (Client* client, this->clients)
+    {
+        if (client->throttled && client->packets.count() < MAX_PENDING_PACKETS / 2)
+        {
+            client->throttled = false;
+            readClient(client);
+        }
+
+        if (!client->packets.isEmpty())
+            scheduleDispatch();
+    }
+}
+
+void OscTcpListener::dispatchPacket(Client* client, const Packet& packet)
+{
+    this->currentClient = client;
+    this->currentReceipt = packet.receipt;
+
+    try
+    {
+        ProcessPacket(packet.data.constData(), packet.data.size(), IpEndpointName(client->ipAddress, client->port));
+    }
+    catch (osc::Exception& e)
+    {
+        qWarning("Malformed OSC packet received from %s: %s", qPrintable(client->statistics.address), e.what());
+
+        client->statistics.droppedPackets++;
+    }
+
+    this->currentClient = nullptr;
+}
+
+void OscTcpListener::ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint)
+{
+    char addressBuffer[IpEndpointName::ADDRESS_STRING_LENGTH];
+
+    endpoint.AddressAsString(addressBuffer);
+
+    QList<QVariant> arguments;
+    for (osc::ReceivedMessage::const_iterator iterator = message.ArgumentsBegin(); iterator != message.ArgumentsEnd(); ++iterator)
+    {
+        const osc::ReceivedMessageArgument& argument = *iterator;
+
+        if (argument.IsBool())
+            arguments.append(argument.AsBool());
+        else if (argument.IsInt32())
+            arguments.append(QVariant::fromValue<qint32>(argument.AsInt32()));
+        else if (argument.IsInt64())
+            arguments.append(QVariant::fromValue<qint64>(argument.AsInt64()));
+        else if (argument.IsFloat())
+            arguments.append(argument.AsFloat());
+        else if (argument.IsDouble())
+            arguments.append(argument.AsDouble());
+        else if (argument.IsString())
+            arguments.append(argument.AsString());
+    }
+
+    QString eventMessage = QString("%1").arg(message.AddressPattern());
+    QString eventPath = QString("%1%2").arg(addressBuffer).arg(message.AddressPattern());
+
+    if (this->currentClient != nullptr)
+        this->currentClient->statistics.messages++;
+
+    if (eventMessage.startsWith("/control"))
+        qDebug("Received OSC message over TCP from %s:%d: %s", addressBuffer, endpoint.port, qPrintable(eventMessage));
+
+    // Unlike the UDP listener nothing is coalesced, every message is delivered in the order it was sent.
+    // Receivers do not share our clock, so the time of receipt is handed over as the age of the message.
+    emit messageReceived(eventPath, arguments, this->clock.nsecsElapsed() - this->currentReceipt);
+}
+
+void OscTcpListener::updateStatistics()
+{
+    double seconds = this->statisticsClock.restart() / 1000.0;
+    if (seconds <= 0)
+        return;
+
+    foreach (Client* client, this->clients)
+    {
+        client->statistics.messagesPerSecond = (client->statistics.messages - client->lastMessages) / seconds;
+        client->statistics.bytesPerSecond = (client->statistics.bytes - client->lastBytes) / seconds;
+        client->statistics.throttled = client->throttled;
+
+        client->lastMessages = client->statistics.messages;
+        client->lastBytes = client->statistics.bytes;
+    }
+
+    if (!this->clients.isEmpty())
+        emit statisticsUpdated();
+}
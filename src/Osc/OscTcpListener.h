@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Shared.h"
+
+#include <osc/OscReceivedElements.h>
+#include <osc/OscPacketListener.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QString>
+#include <QtCore/QVariant>
+
+class QTcpServer;
+class QTcpSocket;
+class QTimer;
+
+class OSC_EXPORT OscTcpListener : public QObject, public osc::OscPacketListener
+{
+    Q_OBJECT
+
+    public:
+        struct ClientStatistics
+        {
+            QString address;
+            quint64 messages = 0;
+            quint64 bytes = 0;
+            quint64 droppedPackets = 0;
+            double messagesPerSecond = 0;
+            double bytesPerSecond = 0;
+            bool throttled = false;
+        };
+
+        explicit OscTcpListener(QObject* parent = 0);
+        ~OscTcpListener();
+
+        void start(int port);
+
+        bool isListening() const;
+        QList<ClientStatistics> getClientStatistics() const;
+
+        Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&, qint64);
+        Q_SIGNAL void statisticsUpdated();
+
+    protected:
+        virtual void ProcessMessage(const osc::ReceivedMessage& message, const IpEndpointName& endpoint);
+
+    private:
+        struct Packet
+        {
+            QByteArray data;
+            qint64 receipt = 0;
+        };
+
+        struct Client
+        {
+            QTcpSocket* socket = nullptr;
+            unsigned long ipAddress = 0;
+            int port = 0;
+            QByteArray frame;
+            bool escaped = false;
+            bool discarding = false;
+            bool throttled = false;
+            QQueue<Packet> packets;
+            ClientStatistics statistics;
+            quint64 lastMessages = 0;
+            quint64 lastBytes = 0;
+        };
+
+        QTcpServer* server = nullptr;
+        QTimer* statisticsTimer = nullptr;
+        QMap<QTcpSocket*, Client*> clients;
+        Client* currentClient = nullptr;
+        qint64 currentReceipt = 0;
+        QElapsedTimer clock;
+        QElapsedTimer statisticsClock;
+        bool dispatchScheduled = false;
+
+        void readClient(Client* client);
+        void decodeSlip(Client* client, const QByteArray& data, qint64 receipt);
+        void dispatchPacket(Client* client, const Packet& packet);
+        void scheduleDispatch();
+
+        Q_SLOT void newConnection();
+        Q_SLOT void disconnected();
+        Q_SLOT void readyRead();
+        Q_SLOT void dispatchPackets();
+        Q_SLOT void updateStatistics();
+};
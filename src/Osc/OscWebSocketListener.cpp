@@ -1,24 +1,39 @@
 #include "OscWebSocketListener.h"
 
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonDocument>
 #include <QtCore/QJsonObject>
 #include <QtCore/QJsonValue>
 #include <QtCore/QString>
+#include <QtCore/QStringList>
 #include <QtCore/QTimer>
 #include <QtCore/QDebug>
 
 #include <QtWebSockets/QWebSocket>
 #include <QtWebSockets/QWebSocketServer>
 
+static const int DEFAULT_STATE_RATE = 10;
+static const int MAX_STATE_RATE = 60;
+static const quint8 BINARY_STATE_VERSION = 1;
+static const int MAX_COMMANDS_PER_SLICE = 64;
+static const int MAX_STATE_KEYS = 4096;
+static const QString CONTROL_PATH = "/control/";
+static const QStringList STATE_TOPICS = QStringList() << "playing" << "time" << "audio" << "device";
+
 OscWebSocketListener::OscWebSocketListener(QObject* parent)
     : QObject(parent)
 {
+    this->throughputClock.start();
 }
 
 OscWebSocketListener::~OscWebSocketListener()
 {
-    this->server->close();
+    if (this->server != nullptr)
+        this->server->close();
+
+    qDeleteAll(this->clients);
     qDeleteAll(this->sockets.begin(), this->sockets.end());
 }
 
@@ -46,7 +61,25 @@ void OscWebSocketListener::newConnection()
     QObject::connect(socket, SIGNAL(disconnected()), this, SLOT(disconnected()));
     QObject::connect(socket, SIGNAL(textMessageReceived(QString)), this, SLOT(textMessageReceived(QString)));
 
+    Client* client = new Client();
+    client->id = ++this->clientId;
+    client->socket = socket;
+    client->timer = new QTimer(this);
+    QObject::connect(client->timer, SIGNAL(timeout()), this, SLOT(sendPendingState()));
+
     this->sockets.append(socket);
+    this->clients.insert(client->id, client);
+}
+
+OscWebSocketListener::Client* OscWebSocketListener::getClient(QWebSocket* socket) const
+{
+    foreach (Client* client, this->clients)
+    {
+        if (client->socket == socket)
+            return client;
+    }
+
+    return nullptr;
 }
 
 /*
@@ -58,40 +91,499 @@ void OscWebSocketListener::newConnection()
  * }
  *
  * For a complete list of valid OSC paths, look in Global.h. First argument
- * must always be a number greater than zero to be executed.
+ * must always be a number greater than zero to be executed, control commands
+ * with any other first argument are answered with an error.
+ *
+ * A frame can also carry an array of commands, each with an optional
+ * correlation id. Commands are executed in order and every command is
+ * answered with an ack once the rundown items it addresses have executed it,
+ * or an error if it could not be executed, e.g. when no item matches the UID
+ * of a control command.
+ *
+ * [
+ *      { "id" : "a1", "path" : "/valid/path", "args" : [ 1 ] },
+ *      { "id" : "a2", "path" : "/valid/path", "args" : [ 1 ] }
+ * ]
+ *
+ * { "type" : "ack", "acks" : [ { "id" : "a1", "path" : "...", "items" : n, "executed" : ms, "latency" : ms } ], "queue" : n, "throughput" : n }
+ * { "type" : "error", "errors" : [ { "id" : "a2", "error" : "..." } ] }
+ *
+ * Sending { "status" : true } returns the current queue depth and throughput
+ * (commands per second) as { "type" : "status", ... }.
+ *
+ * Clients can also subscribe to state topics (playing, time, audio, device),
+ * other topics are answered with an error.
+ * The current state of the subscribed topics is sent right away, after that
+ * only the values that changed are pushed, at most rate times per second.
+ *
+ * {
+ *      "subscribe" : [ "playing", "time", "audio", "device" ],
+ *      "rate" : 10,
+ *      "encoding" : "json" | "binary"
+ * }
+ *
+ * {
+ *      "unsubscribe" : [ "audio" ]
+ * }
+ *
+ * State is pushed as { "type" : "state", "sequence" : n, "changes" : { topic : { key : value } } }
+ * where a null value means the key is gone. The binary encoding carries the same
+ * content big-endian: u8 version, u32 sequence, u8 topic count, then per topic
+ * u8 name length, name, u16 entry count and per entry u16 key length, key, u8 type
+ * (0 = null, 1 = bool as u8, 2 = number as f64, 3 = string as u16 length + UTF-8).
  */
 void OscWebSocketListener::textMessageReceived(const QString& message)
 {
-    QJsonDocument document = QJsonDocument::fromJson(message.toUtf8());
-    QJsonObject object = document.object();
+    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
+    Client* client = getClient(socket);
+
+    QJsonParseError parseError;
+    QJsonDocument document = QJsonDocument::fromJson(message.toUtf8(), &parseError);
+
+    QJsonArray errors;
+    if (document.isArray())
+    {
+        QJsonArray array = document.array();
+        for (int i = 0; i < array.count(); i++)
+            enqueueCommand(client, array[i], errors);
+    }
+    else if (document.isObject())
+    {
+        QJsonObject object = document.object();
+
+        if (client != nullptr && object.contains("subscribe"))
+            subscribe(client, object);
+        else if (client != nullptr && object.contains("unsubscribe"))
+            unsubscribe(client, object);
+        else if (object.contains("status"))
+            sendStatus(socket);
+        else
+            enqueueCommand(client, object, errors);
+    }
+    else
+    {
+        QJsonObject error;
+        error.insert("id", QJsonValue());
+        error.insert("error", QString("Invalid JSON: %1").arg(parseError.errorString()));
+        errors.append(error);
+    }
+
+    if (!errors.isEmpty() && socket != nullptr)
+    {
+        QJsonObject object;
+        object.insert("type", QString("error"));
+        object.insert("errors", errors);
+
+        socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+    }
+}
+
+void OscWebSocketListener::enqueueCommand(Client* client, const QJsonValue& value, QJsonArray& errors)
+{
+    QJsonObject object = value.toObject();
 
-    QString path = object.value("path").toString();
+    Command command;
+    command.client = (client != nullptr) ? client->id : 0;
+    command.id = object.value("id");
+    command.path = object.value("path").toString();
+    command.received = QDateTime::currentMSecsSinceEpoch();
 
-    QList<QVariant> arguments;
     QJsonArray array = object.value("args").toArray();
     for (int i = 0; i < array.count(); i++)
     {
         if (array[i].isBool())
-            arguments.append(array[i].toBool());
+            command.arguments.append(array[i].toBool());
         else if (array[i].isDouble())
-            arguments.append(array[i].toDouble());
+            command.arguments.append(array[i].toDouble());
         else if (array[i].isString())
-            arguments.append(array[i].toString());
+            command.arguments.append(array[i].toString());
+    }
+
+    QString reason;
+    if (!value.isObject())
+        reason = "Command must be an object";
+    else if (command.path.isEmpty())
+        reason = "Missing path";
+    else if (command.arguments.isEmpty())
+        reason = "Missing arguments";
+    else if (command.path.contains(CONTROL_PATH) && command.arguments.first().toInt() <= 0)
+        reason = "First argument must be a number greater than zero"; // The rundown would ignore it.
+
+    if (!reason.isEmpty())
+    {
+        QJsonObject error;
+        error.insert("id", command.id);
+        error.insert("path", command.path);
+        error.insert("error", reason);
+        errors.append(error);
+
+        return;
     }
 
-    if (!path.isEmpty() && arguments.count() > 0)
-        emit messageReceived(path, arguments);
+    this->commands.enqueue(command);
+
+    if (!this->processingScheduled)
+    {
+        this->processingScheduled = true;
+        QTimer::singleShot(0, this, SLOT(processCommands()));
+    }
 }
 
-void OscWebSocketListener::disconnected()
+void OscWebSocketListener::processCommands()
 {
-    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
+    this->processingScheduled = false;
+    this->processing = true;
+
+    // Execute in slices so a large batch does not block the event loop, results for
+    // the same client are collected and sent as one frame per slice.
+    for (int i = 0; i < MAX_COMMANDS_PER_SLICE && !this->commands.isEmpty(); i++)
+    {
+        Command command = this->commands.dequeue();
+        command.ticket = ++this->ticket;
+
+        this->dispatchedCommands.insert(command.ticket, command);
+
+        emit messageReceived(command.path, command.arguments);
+        emit commandReceived(command.ticket, command.path, command.arguments);
+
+        // Without a dispatcher no item can execute the command.
+        if (QObject::receivers(SIGNAL(commandReceived(quint64, const QString&, const QList<QVariant>&))) == 0)
+            commandExecuted(command.ticket, 0);
+
+        this->processedCommands++;
+        this->throughputCommands++;
+    }
+
+    this->processing = false;
+
+    qint64 elapsed = this->throughputClock.elapsed();
+    if (elapsed >= 1000)
+    {
+        this->throughput = this->throughputCommands * 1000.0 / elapsed;
+        this->throughputCommands = 0;
+        this->throughputClock.restart();
+    }
 
-    qDebug("Client %s was disconnected", qPrintable(socket->peerAddress().toString()));
+    sendResults();
 
+    if (!this->commands.isEmpty())
+    {
+        this->processingScheduled = true;
+        QTimer::singleShot(0, this, SLOT(processCommands()));
+    }
+}
+
+/*
+ * Called by the dispatcher once the items matching a command have executed
+ * it, items is the number of items that did. Control commands no item
+ * matches are answered with an error.
+ */
+void OscWebSocketListener::commandExecuted(quint64 ticket, int items)
+{
+    if (!this->dispatchedCommands.contains(ticket))
+        return;
+
+    Command command = this->dispatchedCommands.take(ticket);
+
+    qint64 executed = QDateTime::currentMSecsSinceEpoch();
+
+    // Ids are never reused, a command of a client which went away can not reach a newer one.
+    if (!this->clients.contains(command.client))
+        return; // The client went away, nobody to acknowledge.
+
+    if (items == 0 && command.path.contains(CONTROL_PATH))
+    {
+        QJsonObject error;
+        error.insert("id", command.id);
+        error.insert("path", command.path);
+        error.insert("error", QString("No item matches the path"));
+        this->failures[command.client].append(error);
+    }
+    else
+    {
+        QJsonObject ack;
+        ack.insert("id", command.id);
+        ack.insert("path", command.path);
+        ack.insert("items", items);
+        ack.insert("executed", static_cast<double>(executed));
+        ack.insert("latency", static_cast<double>(executed - command.received));
+        this->acks[command.client].append(ack);
+    }
+
+    if (!this->processing)
+        sendResults();
+}
+
+void OscWebSocketListener::sendResults()
+{
+    foreach (quint64 id, this->failures.keys())
+    {
+        QJsonObject object;
+        object.insert("type", QString("error"));
+        object.insert("errors", this->failures[id]);
+
+        this->clients[id]->socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+    }
+
+    foreach (quint64 id, this->acks.keys())
+    {
+        QJsonObject object;
+        object.insert("type", QString("ack"));
+        object.insert("acks", this->acks[id]);
+        object.insert("queue", this->commands.count());
+        object.insert("throughput", this->throughput);
+
+        this->clients[id]->socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+    }
+
+    this->failures.clear();
+    this->acks.clear();
+}
+
+void OscWebSocketListener::sendStatus(QWebSocket* socket)
+{
+    if (socket == nullptr)
+        return;
+
+    QJsonObject object;
+    object.insert("type", QString("status"));
+    object.insert("queue", this->commands.count());
+    object.insert("throughput", this->throughput);
+    object.insert("processed", static_cast<double>(this->processedCommands));
+    object.insert("clients", this->clients.count());
+
+    socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+}
+
+void OscWebSocketListener::disconnected()
+{
+    QWebSocket* socket = qobject_cast<QWebSocket*>(QObject::sender());
     if (socket != nullptr)
     {
+        qDebug("Client %s was disconnected", qPrintable(socket->peerAddress().toString()));
+
+        Client* client = getClient(socket);
+        if (client != nullptr)
+        {
+            // Forget results of commands still in flight, the client is going away.
+            this->acks.remove(client->id);
+            this->failures.remove(client->id);
+            this->clients.remove(client->id);
+
+            delete client->timer;
+            delete client;
+        }
+
         this->sockets.removeAll(socket);
         socket->deleteLater();
     }
 }
+
+void OscWebSocketListener::publishState(const QString& topic, const QString& key, const QVariant& value)
+{
+    QHash<QString, StateValue>& values = this->state[topic];
+    if (!values.contains(key))
+    {
+        // Keys are kept after they are gone so subscribers learn about it, bound them.
+        if (values.count() >= MAX_STATE_KEYS)
+            pruneState(values);
+
+        if (values.count() >= MAX_STATE_KEYS)
+        {
+            qWarning("Unable to publish %s/%s, too many keys", qPrintable(topic), qPrintable(key));
+            return;
+        }
+
+        if (!value.isValid())
+            return; // Never seen, nothing to remove.
+    }
+
+    StateValue& entry = values[key];
+    if (entry.revision != 0 && entry.value == value)
+        return;
+
+    entry.value = value;
+    entry.revision = ++this->revision;
+}
+
+void OscWebSocketListener::pruneState(QHash<QString, StateValue>& values)
+{
+    quint64 revision = this->revision;
+    foreach (Client* client, this->clients)
+    {
+        if (!client->topics.isEmpty())
+            revision = qMin(revision, client->revision);
+    }
+
+    // Keys which are gone can be dropped once every subscriber has been told.
+    QHash<QString, StateValue>::iterator iterator = values.begin();
+    while (iterator != values.end())
+    {
+        if (!iterator.value().value.isValid() && iterator.value().revision <= revision)
+            iterator = values.erase(iterator);
+        else
+            ++iterator;
+    }
+}
+
+void OscWebSocketListener::subscribe(Client* client, const QJsonObject& object)
+{
+    QSet<QString> topics;
+    QJsonArray errors;
+    QJsonArray array = object.value("subscribe").toArray();
+    for (int i = 0; i < array.count(); i++)
+    {
+        if (!STATE_TOPICS.contains(array[i].toString()))
+        {
+            QJsonObject error;
+            error.insert("subscribe", array[i]);
+            error.insert("error", QString("Unknown topic"));
+            errors.append(error);
+        }
+        else if (!client->topics.contains(array[i].toString()))
+            topics.insert(array[i].toString());
+    }
+
+    if (!errors.isEmpty())
+    {
+        QJsonObject object;
+        object.insert("type", QString("error"));
+        object.insert("errors", errors);
+
+        client->socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+    }
+
+    int rate = qBound(1, object.value("rate").toInt(DEFAULT_STATE_RATE), MAX_STATE_RATE);
+
+    client->binary = (object.value("encoding").toString() == "binary");
+
+    // Bring the existing topics up to date so the snapshot below can move the revision forward.
+    if (client->revision != this->revision)
+        sendState(client, client->topics, client->revision);
+
+    client->revision = this->revision;
+    client->topics.unite(topics);
+    client->timer->start(1000 / rate);
+
+    qDebug("Client %s subscribed to %d topic(s) at %d Hz", qPrintable(client->socket->peerAddress().toString()), client->topics.count(), rate);
+
+    // Start the new topics with a full snapshot, deltas follow on the timer.
+    sendState(client, topics, 0);
+}
+
+void OscWebSocketListener::unsubscribe(Client* client, const QJsonObject& object)
+{
+    QJsonArray array = object.value("unsubscribe").toArray();
+    for (int i = 0; i < array.count(); i++)
+        client->topics.remove(array[i].toString());
+
+    if (client->topics.isEmpty())
+        client->timer->stop();
+}
+
+void OscWebSocketListener::sendPendingState()
+{
+    foreach (Client* client, this->clients)
+    {
+        if (client->timer != QObject::sender())
+            continue;
+
+        if (client->revision != this->revision)
+        {
+            sendState(client, client->topics, client->revision);
+            client->revision = this->revision;
+        }
+
+        break;
+    }
+}
+
+void OscWebSocketListener::sendState(Client* client, const QSet<QString>& topics, quint64 revision)
+{
+    QMap<QString, QHash<QString, QVariant>> changes;
+    foreach (const QString& topic, topics)
+    {
+        const QHash<QString, StateValue> values = this->state.value(topic);
+        for (QHash<QString, StateValue>::const_iterator iterator = values.constBegin(); iterator != values.constEnd(); ++iterator)
+        {
+            if (iterator.value().revision <= revision)
+                continue;
+
+            // A snapshot only carries keys that still exist.
+            if (revision == 0 && !iterator.value().value.isValid())
+                continue;
+
+            changes[topic].insert(iterator.key(), iterator.value().value);
+        }
+    }
+
+    if (changes.isEmpty())
+        return;
+
+    client->sequence++;
+
+    if (client->binary)
+    {
+        client->socket->sendBinaryMessage(encodeBinaryState(client->sequence, changes));
+        return;
+    }
+
+    QJsonObject topicsObject;
+    foreach (const QString& topic, changes.keys())
+    {
+        QJsonObject valuesObject;
+        const QHash<QString, QVariant>& values = changes[topic];
+        for (QHash<QString, QVariant>::const_iterator iterator = values.constBegin(); iterator != values.constEnd(); ++iterator)
+            valuesObject.insert(iterator.key(), QJsonValue::fromVariant(iterator.value()));
+
+        topicsObject.insert(topic, valuesObject);
+    }
+
+    QJsonObject object;
+    object.insert("type", QString("state"));
+    object.insert("sequence", static_cast<double>(client->sequence));
+    object.insert("changes", topicsObject);
+
+    client->socket->sendTextMessage(QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact)));
+}
+
+QByteArray OscWebSocketListener::encodeBinaryState(quint32 sequence, const QMap<QString, QHash<QString, QVariant>>& changes) const
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setByteOrder(QDataStream::BigEndian);
+    stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+    stream << BINARY_STATE_VERSION << sequence << static_cast<quint8>(changes.count());
+    foreach (const QString& topic, changes.keys())
+    {
+        QByteArray name = topic.toUtf8();
+        stream << static_cast<quint8>(name.size());
+        stream.writeRawData(name.constData(), name.size());
+
+        const QHash<QString, QVariant>& values = changes[topic];
+        stream << static_cast<quint16>(values.count());
+        for (QHash<QString, QVariant>::const_iterator iterator = values.constBegin(); iterator != values.constEnd(); ++iterator)
+        {
+            QByteArray key = iterator.key().toUtf8();
+            stream << static_cast<quint16>(key.size());
+            stream.writeRawData(key.constData(), key.size());
+
+            const QVariant& value = iterator.value();
+            if (!value.isValid())
+                stream << static_cast<quint8>(0);
+            else if (value.type() == QVariant::Bool)
+                stream << static_cast<quint8>(1) << static_cast<quint8>(value.toBool());
+            else if (value.type() == QVariant::String)
+            {
+                QByteArray text = value.toString().toUtf8();
+                stream << static_cast<quint8>(3) << static_cast<quint16>(text.size());
+                stream.writeRawData(text.constData(), text.size());
+            }
+            else
+                stream << static_cast<quint8>(2) << value.toDouble();
+        }
+    }
+
+    return data;
+}
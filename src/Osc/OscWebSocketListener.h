@@ -2,10 +2,20 @@
 
 #include "Shared.h"
 
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QJsonValue>
 #include <QtCore/QList>
+#include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QSet>
 #include <QtCore/QVariant>
 
+class QTimer;
 class QWebSocket;
 class QWebSocketServer;
 
@@ -19,13 +29,73 @@ class OSC_EXPORT OscWebSocketListener : public QObject
 
         void start(int port);
 
+        void publishState(const QString& topic, const QString& key, const QVariant& value);
+        void commandExecuted(quint64 ticket, int items);
+
         Q_SIGNAL void messageReceived(const QString&, const QList<QVariant>&);
+        Q_SIGNAL void commandReceived(quint64, const QString&, const QList<QVariant>&);
 
     private:
+        struct StateValue
+        {
+            QVariant value;
+            quint64 revision = 0;
+        };
+
+        struct Client
+        {
+            quint64 id = 0;
+            QWebSocket* socket = nullptr;
+            QTimer* timer = nullptr;
+            QSet<QString> topics;
+            bool binary = false;
+            quint64 revision = 0;
+            quint32 sequence = 0;
+        };
+
+        struct Command
+        {
+            quint64 client = 0;
+            QJsonValue id;
+            QString path;
+            QList<QVariant> arguments;
+            qint64 received = 0;
+            quint64 ticket = 0;
+        };
+
         QList<QWebSocket*> sockets;
         QWebSocketServer* server = nullptr;
 
+        QQueue<Command> commands;
+        QHash<quint64, Command> dispatchedCommands;
+        QMap<quint64, QJsonArray> acks;
+        QMap<quint64, QJsonArray> failures;
+        quint64 ticket = 0;
+        bool processing = false;
+        bool processingScheduled = false;
+        quint64 processedCommands = 0;
+        quint64 throughputCommands = 0;
+        double throughput = 0;
+        QElapsedTimer throughputClock;
+
+        quint64 revision = 0;
+        QMap<QString, QHash<QString, StateValue>> state;
+        quint64 clientId = 0;
+        QMap<quint64, Client*> clients;
+
+        Client* getClient(QWebSocket* socket) const;
+        void enqueueCommand(Client* client, const QJsonValue& value, QJsonArray& errors);
+        void sendStatus(QWebSocket* socket);
+        void sendResults();
+        void pruneState(QHash<QString, StateValue>& values);
+        void subscribe(Client* client, const QJsonObject& object);
+        void unsubscribe(Client* client, const QJsonObject& object);
+        void sendState(Client* client, const QSet<QString>& topics, quint64 revision);
+        QByteArray encodeBinaryState(quint32 sequence, const QMap<QString, QHash<QString, QVariant>>& changes) const;
+
         Q_SLOT void disconnected();
         Q_SLOT void newConnection();
         Q_SLOT void textMessageReceived(const QString& message);
+        Q_SLOT void sendPendingState();
+        Q_SLOT void processCommands();
 };
@@ -0,0 +1,128 @@
+#include "Benchmark.h"
+
+#include <stdio.h>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QTimer>
+
+Benchmark::Benchmark(OscReplayer* replayer, OscListener* listener, int subscribers, QObject* parent)
+    : QObject(parent),
+      replayer(replayer), listener(listener)
+{
+    initialize(listener, subscribers);
+}
+
+Benchmark::Benchmark(OscReplayer* replayer, OscTcpListener* tcpListener, int subscribers, QObject* parent)
+    : QObject(parent),
+      replayer(replayer), tcpListener(tcpListener)
+{
+    initialize(tcpListener, subscribers);
+
+    QObject::connect(this->tcpListener, SIGNAL(statisticsUpdated()), this, SLOT(statisticsUpdated()));
+}
+
+void Benchmark::initialize(QObject* source, int subscribers)
+{
+    // Emulate the suffix matching every OscSubscription does on each message.
+    for (int i = 0; i < subscribers; i++)
+        this->patterns.append(QString("/channel/%1/stage/layer/%2/file/time").arg(i % 4 + 1).arg(i + 1));
+
+    QObject::connect(this->replayer, SIGNAL(finished()), this, SLOT(replayFinished()));
+    QObject::connect(source, SIGNAL(messageReceived(const QString&, const QList<QVariant>&, qint64)),
+                     this, SLOT(messageReceived(const QString&, const QList<QVariant>&)));
+}
+
+void Benchmark::start()
+{
+    if (this->listener != nullptr)
+        this->listener->resetStatistics();
+
+    this->watchdog.start();
+
+    this->replayer->start();
+}
+
+void Benchmark::replayFinished()
+{
+    // Give the listener time to dispatch its last batch.
+    QTimer::singleShot(500, this, SLOT(report()));
+}
+
+void Benchmark::report()
+{
+    this->watchdog.stop();
+
+    if (this->tcpListener != nullptr)
+    {
+        reportTcp();
+        return;
+    }
+
+    OscListener::Statistics statistics = this->listener->getStatistics();
+
+    quint64 sent = this->replayer->getSentMessages();
+    quint64 dropped = (sent > statistics.receivedMessages) ? sent - statistics.receivedMessages : 0;
+    qint64 averageLatency = (statistics.dispatchedMessages > 0) ? statistics.totalDispatchLatency / statistics.dispatchedMessages : 0;
+
+    printf("Replayed %llu datagrams (%llu messages) in %lld ms, max %lld us behind schedule\n",
+           this->replayer->getSentPackets(), sent, this->replayer->getElapsed(), this->replayer->getMaxLateness());
+    printf("Received %llu messages, dropped %llu (%.2f%%)\n",
+           statistics.receivedMessages, dropped, (sent > 0) ? 100.0 * dropped / sent : 0.0);
+    printf("Dispatched %llu messages, %llu coalesced, %llu subscription matches\n",
+           statistics.dispatchedMessages, statistics.receivedMessages - statistics.dispatchedMessages, this->matches);
+    printf("Dispatch latency: average %lld us, max %lld us\n", averageLatency, statistics.maxDispatchLatency);
+    printf("Main thread stall: total %lld ms, max %lld ms\n", this->watchdog.getTotalStall() / 1000, this->watchdog.getMaxStall() / 1000);
+
+    QCoreApplication::exit(dropped > 0 ? 2 : 0);
+}
+
+void Benchmark::reportTcp()
+{
+    quint64 sent = this->replayer->getSentMessages();
+    quint64 dropped = (sent > this->receivedMessages) ? sent - this->receivedMessages : 0;
+
+    printf("Replayed %llu datagrams (%llu messages) over TCP in %lld ms, max %lld us behind schedule\n",
+           this->replayer->getSentPackets(), sent, this->replayer->getElapsed(), this->replayer->getMaxLateness());
+    printf("Received %llu messages, dropped %llu (%.2f%%), %llu subscription matches\n",
+           this->receivedMessages, dropped, (sent > 0) ? 100.0 * dropped / sent : 0.0, this->matches);
+
+    foreach (const ClientReport& report, this->clientReports)
+    {
+        printf("Client %s: %llu messages, %llu bytes, %llu malformed packets, max %.0f messages/s, max %.0f bytes/s%s\n",
+               qPrintable(report.statistics.address), report.statistics.messages, report.statistics.bytes, report.statistics.droppedPackets,
+               report.maxMessagesPerSecond, report.maxBytesPerSecond, report.throttled ? ", throttled" : "");
+    }
+
+    printf("Main thread stall: total %lld ms, max %lld ms\n", this->watchdog.getTotalStall() / 1000, this->watchdog.getMaxStall() / 1000);
+
+    QCoreApplication::exit(dropped > 0 ? 2 : 0);
+}
+
+void Benchmark::statisticsUpdated()
+{
+    // Clients are gone once the replay has finished, keep what they reported.
+    foreach (const OscTcpListener::ClientStatistics& statistics, this->tcpListener->getClientStatistics())
+    {
+        ClientReport& report = this->clientReports[statistics.address];
+        report.statistics = statistics;
+        report.maxMessagesPerSecond = qMax(report.maxMessagesPerSecond, statistics.messagesPerSecond);
+        report.maxBytesPerSecond = qMax(report.maxBytesPerSecond, statistics.bytesPerSecond);
+        report.throttled = report.throttled || statistics.throttled;
+    }
+}
+
+void Benchmark::messageReceived(const QString& path, const QList<QVariant>& arguments)
+{
+    Q_UNUSED(arguments);
+
+    if (path.endsWith(OscReplayer::STARTED_ADDRESS) || path.endsWith(OscReplayer::FINISHED_ADDRESS))
+        return;
+
+    this->receivedMessages++;
+
+    foreach (const QString& pattern, this->patterns)
+    {
+        if (path.endsWith(pattern))
+            this->matches++;
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "OscListener.h"
+#include "OscReplayer.h"
+#include "OscStallWatchdog.h"
+#include "OscTcpListener.h"
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+
+/*
+ * Replays a recording into an in-process OscListener or OscTcpListener over
+ * loopback and measures how the main thread keeps up with it.
+ */
+class Benchmark : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit Benchmark(OscReplayer* replayer, OscListener* listener, int subscribers, QObject* parent = 0);
+        explicit Benchmark(OscReplayer* replayer, OscTcpListener* tcpListener, int subscribers, QObject* parent = 0);
+
+        void start();
+
+    private:
+        struct ClientReport
+        {
+            OscTcpListener::ClientStatistics statistics;
+            double maxMessagesPerSecond = 0;
+            double maxBytesPerSecond = 0;
+            bool throttled = false;
+        };
+
+        OscReplayer* replayer;
+        OscListener* listener = nullptr;
+        OscTcpListener* tcpListener = nullptr;
+
+        QStringList patterns;
+        OscStallWatchdog watchdog;
+        quint64 matches = 0;
+        quint64 receivedMessages = 0;
+        QMap<QString, ClientReport> clientReports;
+
+        void initialize(QObject* source, int subscribers);
+        void reportTcp();
+
+        Q_SLOT void replayFinished();
+        Q_SLOT void report();
+        Q_SLOT void messageReceived(const QString& path, const QList<QVariant>& arguments);
+        Q_SLOT void statisticsUpdated();
+};
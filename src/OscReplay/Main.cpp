@@ -0,0 +1,160 @@
+#include "Global.h"
+
+#include "Benchmark.h"
+
+#include "OscListener.h"
+#include "OscReplayer.h"
+#include "OscTcpListener.h"
+
+#include <stdio.h>
+
+#include <QtCore/QCommandLineOption>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QTimer>
+
+// Loopback port used by the in-process listener of the benchmark.
+static const int BENCHMARK_PORT = 16250;
+
+double parseSpeed(const QString& value)
+{
+    if (value == "max")
+        return 0;
+
+    bool ok = false;
+    double speed = value.toDouble(&ok);
+
+    return (ok && speed > 0) ? speed : -1;
+}
+
+int record(QCoreApplication& application, const QCommandLineParser& parser, const QString& path)
+{
+    OscListener listener("0.0.0.0", parser.value("port").toInt());
+    if (!listener.startRecording(path))
+        return 1;
+
+    listener.start();
+
+    if (parser.isSet("duration"))
+        QTimer::singleShot(parser.value("duration").toInt() * 1000, &application, SLOT(quit()));
+
+    int returnValue = application.exec();
+
+    listener.stopRecording();
+
+    return returnValue;
+}
+
+int replay(QCoreApplication& application, const QCommandLineParser& parser, OscReplayer& replayer)
+{
+    // Without an explicit port a TCP replay goes to the default OSC TCP port of the client.
+    int port = parser.value("port").toInt();
+    if (parser.isSet("tcp") && !parser.isSet("port"))
+        port = Osc::DEFAULT_TCP_PORT;
+
+    replayer.setTarget(parser.value("address"), port);
+
+    QObject::connect(&replayer, SIGNAL(finished()), &application, SLOT(quit()));
+    replayer.start();
+
+    int returnValue = application.exec();
+
+    printf("Replayed %llu datagrams (%llu messages) in %lld ms, max %lld us behind schedule\n",
+           replayer.getSentPackets(), replayer.getSentMessages(), replayer.getElapsed(), replayer.getMaxLateness());
+
+    return returnValue;
+}
+
+int benchmarkTcp(QCoreApplication& application, const QCommandLineParser& parser, OscReplayer& replayer)
+{
+    OscTcpListener listener;
+    listener.start(BENCHMARK_PORT);
+    if (!listener.isListening())
+        return 1;
+
+    replayer.setTarget("127.0.0.1", BENCHMARK_PORT);
+
+    Benchmark benchmark(&replayer, &listener, parser.value("subscribers").toInt());
+    benchmark.start();
+
+    return application.exec();
+}
+
+int benchmark(QCoreApplication& application, const QCommandLineParser& parser, OscReplayer& replayer)
+{
+    if (parser.isSet("tcp"))
+        return benchmarkTcp(application, parser, replayer);
+
+    OscListener listener("127.0.0.1", BENCHMARK_PORT);
+    listener.start();
+
+    replayer.setTarget("127.0.0.1", BENCHMARK_PORT);
+
+    Benchmark benchmark(&replayer, &listener, parser.value("subscribers").toInt());
+    benchmark.start();
+
+    return application.exec();
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setApplicationName("oscreplay");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Records incoming OSC datagrams and replays them for load testing.\n\n"
+                                     "record     Record datagrams arriving on the OSC port.\n"
+                                     "replay     Send a recording to a running client, which logs dispatch\n"
+                                     "           latency, main thread stall and dropped messages at the end.\n"
+                                     "benchmark  Replay into an in-process listener over loopback and report\n"
+                                     "           dispatch latency, main thread stall and dropped messages.\n\n"
+                                     "Replayed datagrams originate from the replaying host, so the device\n"
+                                     "address in the client must match it, e.g. 127.0.0.1 on loopback.\n"
+                                     "With --tcp datagrams are sent as SLIP frames over one TCP connection,\n"
+                                     "the benchmark then reports the rates of the TCP listener per client.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("mode", "record, replay or benchmark.");
+    parser.addPositionalArgument("file", "The recording path.");
+    parser.addOption({{"a", "address"}, "Replay target address.", "address", "127.0.0.1"});
+    parser.addOption({{"p", "port"}, "OSC port to record from or replay to.", "port", QString::number(Osc::DEFAULT_PORT)});
+    parser.addOption({{"s", "speed"}, "Replay speed, e.g. 1, 10 or max.", "speed", "1"});
+    parser.addOption({{"d", "duration"}, "Stop recording after the given number of seconds.", "duration"});
+    parser.addOption({{"n", "subscribers"}, "Number of emulated subscriptions in the benchmark.", "subscribers", "0"});
+    parser.addOption({{"t", "tcp"}, "Replay over TCP instead of UDP."});
+    parser.process(application);
+
+    QStringList arguments = parser.positionalArguments();
+    if (arguments.count() != 2)
+        parser.showHelp(1);
+
+    QString mode = arguments.at(0);
+    QString path = arguments.at(1);
+
+    if (mode == "record")
+        return record(application, parser, path);
+
+    double speed = parseSpeed(parser.value("speed"));
+    if (speed < 0)
+    {
+        qCritical("Invalid replay speed %s", qPrintable(parser.value("speed")));
+        return 1;
+    }
+
+    OscReplayer replayer;
+    if (!replayer.load(path))
+        return 1;
+
+    replayer.setSpeed(speed);
+    replayer.setTcp(parser.isSet("tcp"));
+
+    qDebug("Loaded %d datagrams (%llu messages) spanning %lld ms", replayer.getPacketCount(), replayer.getMessageCount(), replayer.getDuration());
+
+    if (mode == "replay")
+        return replay(application, parser, replayer);
+    else if (mode == "benchmark")
+        return benchmark(application, parser, replayer);
+
+    parser.showHelp(1);
+}
@@ -0,0 +1,45 @@
+QT += core network
+QT -= gui
+
+CONFIG += c++11 console
+CONFIG -= app_bundle
+
+TARGET = oscreplay
+TEMPLATE = app
+
+HEADERS += \
+    Benchmark.h
+
+SOURCES += \
+    Main.cpp \
+    Benchmark.cpp
+
+CONFIG(system-boost) {
+    LIBS += -lboost_date_time -lboost_system -lboost_thread -lboost_filesystem -lboost_chrono
+} else {
+    DEPENDPATH += $$PWD/../../lib/boost
+    INCLUDEPATH += $$PWD/../../lib/boost
+    win32:LIBS += -L$$PWD/../../lib/boost/stage/lib/win32/ -lboost_date_time-mgw49-mt-1_57 -lboost_system-mgw49-mt-1_57 -lboost_thread-mgw49-mt-1_57 -lboost_filesystem-mgw49-mt-1_57 -lboost_chrono-mgw49-mt-1_57 -lws2_32
+    else:macx:LIBS += -L$$PWD/../../lib/boost/stage/lib/macx/ -lboost_date_time -lboost_system -lboost_thread -lboost_filesystem -lboost_chrono
+    else:unix:LIBS += -L$$PWD/../../lib/boost/stage/lib/linux/ -lboost_date_time -lboost_system -lboost_thread -lboost_filesystem -lboost_chrono
+}
+
+CONFIG(system-oscpack) {
+    LIBS += -loscpack
+} else {
+    DEPENDPATH += $$PWD/../../lib/oscpack/include
+    INCLUDEPATH += $$PWD/../../lib/oscpack/include
+    win32:LIBS += -L$$PWD/../../lib/oscpack/lib/win32/ -loscpack
+    else:macx:LIBS += -L$$PWD/../../lib/oscpack/lib/macx/ -loscpack
+    else:unix:LIBS += -L$$PWD/../../lib/oscpack/lib/linux/ -loscpack
+}
+
+DEPENDPATH += $$OUT_PWD/../Osc $$PWD/../Osc
+INCLUDEPATH += $$OUT_PWD/../Osc $$PWD/../Osc
+win32:CONFIG(release, debug|release):LIBS += -L$$OUT_PWD/../Osc/release/ -losc
+else:win32:CONFIG(debug, debug|release):LIBS += -L$$OUT_PWD/../Osc/debug/ -losc
+else:macx:LIBS += -L$$OUT_PWD/../Osc/ -losc
+else:unix:LIBS += -L$$OUT_PWD/../Osc/ -losc
+
+DEPENDPATH += $$PWD/../Common
+INCLUDEPATH += $$PWD/../Common
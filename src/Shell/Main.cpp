@@ -9,8 +9,12 @@
 #include "../Core/LibraryManager.h"
 #include "../Core/DeviceManager.h"
 #include "../Core/OscDeviceManager.h"
+#include "../Core/OscSubscriptionManager.h"
 #include "../Core/OscWebSocketManager.h"
+#include "../Core/LiveDataManager.h"
+#include "../Core/StageStateManager.h"
 #include "../Core/AtemDeviceManager.h"
+#include "../Core/CommandScheduler.h"
 #include "../Core/TriCasterDeviceManager.h"
 #include "../Core/Events/Rundown/OpenRundownEvent.h"
 
@@ -43,6 +47,8 @@ struct CommandLineArgs
     QString mysqldb;
     QString sqlitepath;
 
+    QString oscrecord;
+
     bool dbmemory = false;
     bool fullscreen = false;
 };
@@ -240,6 +246,7 @@ CommandLineParseResult parseCommandLine(QCommandLineParser& parser, CommandLineA
     parser.addOption({{"u", "mysqluser"}, "MySQL database user.", "mysqluser"});
     parser.addOption({{"p", "mysqlpass"}, "MySQL database password.", "mysqlpass"});
     parser.addOption({{"n", "mysqldb"}, "MySQL database name.", "mysqldb"});
+    parser.addOption({{"o", "oscrecord"}, "Record incoming OSC datagrams to the given path.", "oscrecord"});
 
     if (!parser.parse(QApplication::arguments()))
         return CommandLineError;
@@ -274,6 +281,9 @@ CommandLineParseResult parseCommandLine(QCommandLineParser& parser, CommandLineA
     if (parser.isSet("sqlitepath"))
         args->sqlitepath = parser.value("sqlitepath");
 
+    if (parser.isSet("oscrecord"))
+        args->oscrecord = parser.value("oscrecord");
+
     return CommandLineOk;
 }
 
@@ -331,13 +341,24 @@ int main(int argc, char* argv[])
     AtemDeviceManager::getInstance().initialize();
     TriCasterDeviceManager::getInstance().initialize();
     OscDeviceManager::getInstance().initialize();
+    if (!args.oscrecord.isEmpty())
+        OscDeviceManager::getInstance().getOscListener()->startRecording(args.oscrecord);
+
     OscWebSocketManager::getInstance().initialize();
+    StageStateManager::getInstance().initialize();
+    OscSubscriptionManager::getInstance().initialize();
+    LiveDataManager::getInstance().initialize();
+    CommandScheduler::getInstance().initialize();
 
     int returnValue = application.exec();
 
     EventManager::getInstance().uninitialize();
     DatabaseManager::getInstance().uninitialize();
     GpiManager::getInstance().uninitialize();
+    CommandScheduler::getInstance().uninitialize();
+    LiveDataManager::getInstance().uninitialize();
+    OscSubscriptionManager::getInstance().uninitialize();
+    StageStateManager::getInstance().uninitialize();
     OscWebSocketManager::getInstance().uninitialize();
     OscDeviceManager::getInstance().uninitialize();
     TriCasterDeviceManager::getInstance().uninitialize();
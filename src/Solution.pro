@@ -11,11 +11,15 @@ SUBDIRS += \
     Web \
     Gpi \
     Osc \
+    OscReplay \
+    TakeBenchmark \
     Repository \
     Core \
     Widgets \
     Shell
 
-Core.depends = Atem Caspar TriCaster Osc Gpi Common
+OscReplay.depends = Osc
+TakeBenchmark.depends = Atem Caspar TriCaster Web Osc Gpi Common Core
+Core.depends = Atem Caspar TriCaster Web Osc Gpi Common
 Widgets.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core
 Shell.depends = Atem Caspar TriCaster Panasonic Sony Spyder Web Osc Repository Gpi Common Core Widgets
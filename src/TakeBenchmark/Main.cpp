@@ -0,0 +1,156 @@
+#include "Global.h"
+
+#include "AmcpDevice.h"
+#include "CasparDevice.h"
+
+#include "Commands/AudioCommand.h"
+#include "Commands/MovieCommand.h"
+#include "Commands/StillCommand.h"
+
+#include <stdio.h>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QString>
+
+// Stands in for the socket send buffer, emptied whenever it is full.
+static const int BUFFER_SIZE = 65536;
+
+static QByteArray buffer;
+
+typedef QString (*FormatFunction)(const AbstractCommand*);
+typedef void (*EditFunction)(AbstractCommand*, int);
+
+void write(const QByteArray& message)
+{
+    if (buffer.size() > BUFFER_SIZE)
+        buffer.clear();
+
+    buffer.append(message);
+}
+
+QString formatMovie(const AbstractCommand* command)
+{
+    const MovieCommand* movie = static_cast<const MovieCommand*>(command);
+
+    return CasparDevice::getPlayMovieMessage(movie->getChannel(), movie->getVideolayer(), movie->getVideoName(), movie->getTransition(),
+                                             movie->getTransitionDuration(), movie->getTween(), movie->getDirection(), movie->getSeek(),
+                                             movie->getLength(), movie->getLoop(), movie->getAutoPlay());
+}
+
+QString formatStill(const AbstractCommand* command)
+{
+    const StillCommand* still = static_cast<const StillCommand*>(command);
+
+    return CasparDevice::getPlayStillMessage(still->getChannel(), still->getVideolayer(), still->getImageName(), still->getTransition(),
+                                             still->getTransitionDuration(), still->getTween(), still->getDirection(), still->getUseAuto());
+}
+
+QString formatAudio(const AbstractCommand* command)
+{
+    const AudioCommand* audio = static_cast<const AudioCommand*>(command);
+
+    return CasparDevice::getPlayAudioMessage(audio->getChannel(), audio->getVideolayer(), audio->getAudioName(), audio->getTransition(),
+                                             audio->getTransitionDuration(), audio->getTween(), audio->getDirection(), audio->getLoop(),
+                                             audio->getUseAuto());
+}
+
+void editMovie(AbstractCommand* command, int take)
+{
+    static_cast<MovieCommand*>(command)->setSeek(take % 250);
+}
+
+void editStill(AbstractCommand* command, int take)
+{
+    static_cast<StillCommand*>(command)->setTransitionDuration(take % 250);
+}
+
+void editAudio(AbstractCommand* command, int take)
+{
+    static_cast<AudioCommand*>(command)->setTransitionDuration(take % 250);
+}
+
+void run(const char* name, AbstractCommand* command, FormatFunction format, EditFunction edit, int takes, int devices)
+{
+    QElapsedTimer timer;
+
+    // What producing the message cost before, it is formatted and encoded for every server.
+    timer.start();
+    for (int i = 0; i < takes; i++)
+    {
+        for (int j = 0; j < devices; j++)
+            write(AmcpDevice::encodeMessage(format(command)));
+    }
+    qint64 formatted = timer.nsecsElapsed();
+
+    // An unchanged item, a lookup of the compiled message and a write per server.
+    timer.restart();
+    for (int i = 0; i < takes; i++)
+    {
+        const QByteArray& message = command->getAmcpMessage(AbstractCommand::AmcpMessage::Play);
+        for (int j = 0; j < devices; j++)
+            write(message);
+    }
+    qint64 cached = timer.nsecsElapsed();
+
+    // The worst case, the item is edited between every take and compiled again.
+    timer.restart();
+    for (int i = 0; i < takes; i++)
+    {
+        edit(command, i);
+
+        const QByteArray& message = command->getAmcpMessage(AbstractCommand::AmcpMessage::Play);
+        for (int j = 0; j < devices; j++)
+            write(message);
+    }
+    qint64 edited = timer.nsecsElapsed();
+
+    printf("%-6s %10.3f us formatted  %10.3f us cached  %10.3f us edited  (%.1fx)\n", name,
+           formatted / 1000.0 / takes, cached / 1000.0 / takes, edited / 1000.0 / takes,
+           (cached > 0) ? double(formatted) / cached : 0.0);
+}
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication application(argc, argv);
+    application.setApplicationName("takebenchmark");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures the CPU time spent producing the AMCP message of a take per rundown\n"
+                                     "item type, formatting the message on every take against sending the message\n"
+                                     "compiled by the command. Messages are written to a buffer, not a server.\n\n"
+                                     "This is not the latency of a take, the rest of the take path in the rundown,\n"
+                                     "such as finding the item, its widget and its device, is not part of it.");
+    parser.addHelpOption();
+    parser.addOption({{"n", "takes"}, "Number of takes per item type.", "takes", "100000"});
+    parser.addOption({{"d", "devices"}, "Number of servers each take is sent to, e.g. with shadow servers.", "devices", "1"});
+    parser.process(application);
+
+    int takes = qMax(parser.value("takes").toInt(), 1);
+    int devices = qMax(parser.value("devices").toInt(), 1);
+
+    MovieCommand movie;
+    movie.setVideoName("AMB");
+    movie.setTransition("MIX");
+    movie.setTransitionDuration(25);
+    movie.setLoop(true);
+
+    StillCommand still;
+    still.setImageName("CG1080i50");
+    still.setTransition("PUSH");
+    still.setTransitionDuration(12);
+
+    AudioCommand audio;
+    audio.setAudioName("SOUNDBED");
+    audio.setLoop(true);
+
+    printf("AMCP message cost of %d takes per item type to %d server(s)\n", takes, devices);
+
+    run("Movie", &movie, formatMovie, editMovie, takes, devices);
+    run("Still", &still, formatStill, editStill, takes, devices);
+    run("Audio", &audio, formatAudio, editAudio, takes, devices);
+
+    return 0;
+}
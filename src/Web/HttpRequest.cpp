@@ -5,8 +5,11 @@
 #include <QtCore/QUrl>
 
 HttpRequest::HttpRequest(QObject* parent)
-    : QObject(parent)
+    : QObject(parent),
+      networkManager(new QNetworkAccessManager(this))
 {
+    // One manager for every request, its connections are kept alive between requests.
+    QObject::connect(this->networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(requestFinished(QNetworkReply*)));
 }
 
 void HttpRequest::sendGet(const QString& url, const QUrlQuery& query)
@@ -16,36 +19,29 @@ void HttpRequest::sendGet(const QString& url, const QUrlQuery& query)
 
     qDebug("HttpRequest::sendGet %s", qPrintable(request.toString()));
 
-    this->networkManager = new QNetworkAccessManager(this);
-    QObject::connect(this->networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(sendGetFinished(QNetworkReply*)));
     this->networkManager->get(QNetworkRequest(request));
 }
 
-void HttpRequest::sendGetFinished(QNetworkReply* reply)
-{
-    QString data = QString::fromUtf8(reply->readAll());
-
-    qDebug("HttpRequest::sendGetFinished %s", qPrintable(data));
-
-    reply->deleteLater();
-    this->networkManager->deleteLater();
-}
-
 void HttpRequest::sendPost(const QString& url, const QUrlQuery& query)
 {
     qDebug("HttpRequest::sendPost %s, %s", qPrintable(url), qPrintable(query.toString(QUrl::FullyEncoded)));
 
-    this->networkManager = new QNetworkAccessManager(this);
-    QObject::connect(this->networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(sendPostFinished(QNetworkReply*)));
     this->networkManager->post(QNetworkRequest(QUrl(url)), query.toString(QUrl::FullyEncoded).toUtf8());
 }
 
-void HttpRequest::sendPostFinished(QNetworkReply* reply)
+void HttpRequest::requestFinished(QNetworkReply* reply)
 {
-    QString data = QString::fromUtf8(reply->readAll());
+    reply->deleteLater();
 
-    qDebug("HttpRequest::sendPostFinished %s", qPrintable(data));
+    // Error pages are not a response.
+    int status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+    if (reply->error() != QNetworkReply::NoError || status < 200 || status > 299)
+    {
+        qWarning("HTTP request to %s failed: %s", qPrintable(reply->url().toString()), qPrintable(reply->errorString()));
 
-    reply->deleteLater();
-    this->networkManager->deleteLater();
+        emit requestFailed(reply->errorString());
+        return;
+    }
+
+    emit responseReceived(QString::fromUtf8(reply->readAll()));
 }
@@ -20,9 +20,11 @@ class WEB_EXPORT HttpRequest : public QObject
         void sendGet(const QString& url, const QUrlQuery& query);
         void sendPost(const QString& url, const QUrlQuery& query);
 
+        Q_SIGNAL void responseReceived(const QString&);
+        Q_SIGNAL void requestFailed(const QString&);
+
     private:
         QNetworkAccessManager* networkManager;
 
-        Q_SLOT void sendGetFinished(QNetworkReply*);
-        Q_SLOT void sendPostFinished(QNetworkReply*);
+        Q_SLOT void requestFinished(QNetworkReply*);
 };
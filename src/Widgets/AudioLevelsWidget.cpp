@@ -1,5 +1,4 @@
 #include "AudioLevelsWidget.h"
-#include "AudioMeterWidget.h"
 
 #include "Global.h"
 
@@ -14,9 +13,6 @@ AudioLevelsWidget::AudioLevelsWidget(QWidget* parent)
 {
     setupUi(this);
     setupMenus();
-
-    for (int i = 1; i < 9; i++)
-        this->findChild<AudioMeterWidget*>(QString("widgetAudioMeter%1").arg(i))->configureAudioMeter(i);
 }
 
 void AudioLevelsWidget::setupMenus()
@@ -2,26 +2,43 @@
 
 #include "Global.h"
 
-#include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
+#include "StageStateManager.h"
+
+#include <QtGui/QLinearGradient>
+#include <QtGui/QPainter>
+
+static const int DISPLAY_INTERVAL = 40; // 25 updates per second, independent of the OSC message rate.
+static const int DEFAULT_AUDIO_CHANNELS = 8;
+static const float MINIMUM_LEVEL = -61.0f;
+static const float DECAY_RATE = 20.0f; // dB per second.
+static const float PEAK_HOLD = 1500.0f; // Milliseconds.
+static const float CLIP_LEVEL = -0.5f;
+static const int SCALE_WIDTH = 20;
+static const int LABEL_HEIGHT = 14;
+static const int MAXIMUM_SLOT_WIDTH = 32;
+static const int SCALE_LEVELS[] = { 0, -9, -20, -60 };
 
 AudioMeterWidget::AudioMeterWidget(QWidget* parent)
     : QWidget(parent),
-      channel(-1), model(NULL), command(NULL), audioSubscription(NULL)
+      model(NULL), command(NULL), borderColor(42, 42, 42)
 {
-    setupUi(this);
-
     QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(channelChanged(const ChannelChangedEvent&)), this, SLOT(channelChanged(const ChannelChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(emptyRundown(const EmptyRundownEvent&)), this, SLOT(emptyRundown(const EmptyRundownEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), this, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
 }
 
-void AudioMeterWidget::configureAudioMeter(int channel)
+const QColor& AudioMeterWidget::getBorderColor() const
+{
+    return this->borderColor;
+}
+
+void AudioMeterWidget::setBorderColor(const QColor& borderColor)
 {
-    this->channel = channel;
-    this->labelAudioMeterChannel->setText(QString("Ch %1").arg(channel));
+    this->borderColor = borderColor;
+    update();
 }
 
 void AudioMeterWidget::deviceChanged(const DeviceChangedEvent& event)
@@ -30,44 +47,24 @@ void AudioMeterWidget::deviceChanged(const DeviceChangedEvent& event)
         return;
 
     if (!event.getDeviceName().isEmpty() && event.getDeviceName() != this->model->getDeviceName())
-    {
-        if (this->audioSubscription != NULL)
-            this->audioSubscription->disconnect(); // Disconnect all events.
-
-        if (DeviceManager::getInstance().getDeviceByName(event.getDeviceName()) == NULL)
-            return;
-
-        this->progressBarAudioMeter->setValue(-61);
-        this->progressBarAudioMeter->update();
-
-        QString audioFilter = Osc::DEFAULT_AUDIO_FILTER;
-        audioFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(event.getDeviceName())->resolveIpAddress()))
-                   .replace("#CHANNEL#", QString("%1").arg(this->command->getChannel()))
-                   .replace("#AUDIOCHANNEL#", QString("%1").arg(this->channel));
-        this->audioSubscription = new OscSubscription(audioFilter, this);
-        QObject::connect(this->audioSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                         this, SLOT(audioSubscriptionReceived(const QString&, const QList<QVariant>&)));
-    }
+        configureChannelKey(event.getDeviceName());
 }
 
 void AudioMeterWidget::channelChanged(const ChannelChangedEvent& event)
 {
     Q_UNUSED(event);
 
-    configureOscSubscriptions();
+    if (this->model != NULL)
+        configureChannelKey(this->model->getDeviceName());
 }
 
 void AudioMeterWidget::emptyRundown(const EmptyRundownEvent& event)
 {
     Q_UNUSED(event);
 
-    if (this->audioSubscription != NULL)
-        this->audioSubscription->disconnect(); // Disconnect all events.
-
     this->model = NULL;
 
-    this->progressBarAudioMeter->setValue(-61);
-    this->progressBarAudioMeter->update();
+    configureChannelKey(QString());
 }
 
 void AudioMeterWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
@@ -75,41 +72,177 @@ void AudioMeterWidget::rundownItemSelected(const RundownItemSelectedEvent& event
     this->model = event.getLibraryModel();
     this->command = dynamic_cast<AbstractCommand*>(event.getCommand());
 
-    configureOscSubscriptions();
+    configureChannelKey((this->model != NULL) ? this->model->getDeviceName() : QString());
 }
 
-void AudioMeterWidget::configureOscSubscriptions()
+void AudioMeterWidget::configureChannelKey(const QString& deviceName)
 {
-    if (this->audioSubscription != NULL)
-        this->audioSubscription->disconnect(); // Disconnect all events.
+    QString channelKey;
 
-    if (this->model == NULL)
-        return;
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(deviceName);
+    if (device != NULL && this->command != NULL)
+        channelKey = StageStateManager::getChannelKey(device->resolveIpAddress(), this->command->getChannel());
 
-    if (DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName()) == NULL)
+    if (channelKey == this->channelKey)
         return;
 
-    QString audioFilter = Osc::DEFAULT_AUDIO_FILTER;
-    audioFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model->getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command->getChannel()))
-               .replace("#AUDIOCHANNEL#", QString("%1").arg(this->channel));
-    this->audioSubscription = new OscSubscription(audioFilter, this);
-    QObject::connect(this->audioSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(audioSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    this->channelKey = channelKey;
+
+    // The meters of another channel start from silence.
+    this->levels.clear();
+    this->peaks.clear();
+    this->holds.clear();
+
+    updateRefreshTimer();
+    update();
+}
+
+void AudioMeterWidget::showEvent(QShowEvent* event)
+{
+    QWidget::showEvent(event);
+
+    updateRefreshTimer();
 }
 
-void AudioMeterWidget::audioSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void AudioMeterWidget::hideEvent(QHideEvent* event)
 {
-    Q_UNUSED(predicate);
+    QWidget::hideEvent(event);
 
-    //qDebug("%s%s", qPrintable(predicate), qPrintable(arguments));
+    updateRefreshTimer();
+}
 
-    int value = arguments.at(0).toInt();
-    if (value < -60)
-        this->progressBarAudioMeter->setValue(-61);
+void AudioMeterWidget::updateRefreshTimer()
+{
+    // Nothing is read while there is no channel to show or nobody can see it.
+    if (!this->channelKey.isEmpty() && isVisible())
+    {
+        if (!this->refreshTimer.isActive())
+            this->refreshTimer.start(DISPLAY_INTERVAL, this);
+    }
     else
     {
-        this->progressBarAudioMeter->setValue(arguments.at(0).toInt());
-        this->progressBarAudioMeter->update();
+        this->refreshTimer.stop();
+    }
+}
+
+void AudioMeterWidget::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != this->refreshTimer.timerId())
+    {
+        QWidget::timerEvent(event);
+        return;
+    }
+
+    refreshLevels();
+}
+
+void AudioMeterWidget::refreshLevels()
+{
+    // The stage state keeps the last level of every audio channel, messages received in between are never seen here.
+    const QVector<float> input = StageStateManager::getInstance().getAudioLevels(this->channelKey);
+
+    bool changed = false;
+    int count = input.count();
+    if (count != this->levels.count())
+    {
+        this->levels.fill(MINIMUM_LEVEL, count);
+        this->peaks.fill(MINIMUM_LEVEL, count);
+        this->holds.fill(0, count);
+
+        changed = true;
+    }
+
+    const float fall = DECAY_RATE * DISPLAY_INTERVAL / 1000.0f;
+    const float* source = input.constData();
+    float* levels = this->levels.data();
+    float* peaks = this->peaks.data();
+    float* holds = this->holds.data();
+
+    for (int i = 0; i < count; i++)
+    {
+        float value = qMax(source[i], MINIMUM_LEVEL);
+
+        float level = qMax(value, qMax(levels[i] - fall, MINIMUM_LEVEL));
+        bool peaked = (value >= peaks[i]);
+        float peak = peaked ? value : ((holds[i] > 0) ? peaks[i] : qMax(peaks[i] - fall, MINIMUM_LEVEL));
+        float hold = peaked ? PEAK_HOLD : holds[i] - DISPLAY_INTERVAL;
+
+        changed |= (level != levels[i]) | (peak != peaks[i]);
+
+        levels[i] = level;
+        peaks[i] = peak;
+        holds[i] = hold;
+    }
+
+    if (changed)
+        update();
+}
+
+int AudioMeterWidget::getLevelPosition(float level, int top, int height) const
+{
+    return top + qRound(height * (level / MINIMUM_LEVEL));
+}
+
+void AudioMeterWidget::paintEvent(QPaintEvent* event)
+{
+    Q_UNUSED(event);
+
+    int count = (this->levels.isEmpty()) ? DEFAULT_AUDIO_CHANNELS : this->levels.count();
+
+    int top = fontMetrics().height() / 2;
+    int height = this->height() - top - LABEL_HEIGHT;
+    if (height < 10)
+        return;
+
+    int slotWidth = qMin(MAXIMUM_SLOT_WIDTH, (this->width() - SCALE_WIDTH) / count);
+    if (slotWidth < 3)
+        return;
+
+    int meterWidth = qBound(3, slotWidth / 3, 6);
+    int left = (this->width() - SCALE_WIDTH - slotWidth * count) / 2 + SCALE_WIDTH;
+
+    const QColor textColor = palette().color(QPalette::WindowText);
+
+    QPainter painter(this);
+    painter.setPen(textColor);
+
+    for (unsigned int i = 0; i < sizeof(SCALE_LEVELS) / sizeof(SCALE_LEVELS[0]); i++)
+    {
+        int y = getLevelPosition(SCALE_LEVELS[i], top, height);
+        painter.drawText(QRect(left - SCALE_WIDTH, y - top, SCALE_WIDTH - 3, top * 2), Qt::AlignRight | Qt::AlignVCenter, QString::number(SCALE_LEVELS[i]));
+    }
+
+    // Channel numbers are thinned out when the meters are too narrow for all of them.
+    int labelWidth = fontMetrics().width(QString::number(count)) + 4;
+    int labelStep = (labelWidth + slotWidth - 1) / slotWidth;
+
+    QLinearGradient gradient(0, top + height, 0, top);
+    gradient.setColorAt(0, QColor(Qt::darkGreen));
+    gradient.setColorAt(1, QColor(Qt::green));
+
+    for (int i = 0; i < count; i++)
+    {
+        int x = left + i * slotWidth + (slotWidth - meterWidth) / 2;
+
+        painter.setPen(this->borderColor);
+        painter.drawRect(x, top, meterWidth - 1, height - 1);
+
+        if (i < this->levels.count())
+        {
+            int y = qMax(getLevelPosition(this->levels.at(i), top, height), top + 1);
+            painter.fillRect(x + 1, y, meterWidth - 2, top + height - 1 - y, gradient);
+
+            if (this->peaks.at(i) > MINIMUM_LEVEL)
+            {
+                y = getLevelPosition(this->peaks.at(i), top, height);
+                painter.fillRect(x + 1, qBound(top + 1, y, top + height - 2), meterWidth - 2, 1, (this->peaks.at(i) >= CLIP_LEVEL) ? QColor(Qt::red) : QColor(Qt::green));
+            }
+        }
+
+        if (i % labelStep == 0)
+        {
+            painter.setPen(textColor);
+            painter.drawText(QRect(left + i * slotWidth - slotWidth, top + height, slotWidth * 3, LABEL_HEIGHT), Qt::AlignCenter, QString::number(i + 1));
+        }
     }
 }
@@ -1,40 +1,63 @@
 #pragma once
 
 #include "Shared.h"
-#include "ui_AudioMeterWidget.h"
 
-#include "OscSubscription.h"
 #include "Events/Inspector/ChannelChangedEvent.h"
 #include "Events/Inspector/DeviceChangedEvent.h"
 #include "Events/Rundown/EmptyRundownEvent.h"
 #include "Events/Rundown/RundownItemSelectedEvent.h"
 #include "Models/LibraryModel.h"
 
-#include <QtGui/QImage>
+#include <QtCore/QBasicTimer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include <QtGui/QColor>
+#include <QtGui/QPaintEvent>
 
 #include <QtWidgets/QWidget>
 
-class WIDGETS_EXPORT AudioMeterWidget : public QWidget, Ui::AudioMeterWidget
+/*
+ * Painted meter bank for every audio channel of the CasparCG channel of the
+ * selected item. Levels are read from the stage state at a fixed display
+ * rate, however fast the server sends them, and the bar and peak hold of all
+ * channels are computed in one pass.
+ */
+class WIDGETS_EXPORT AudioMeterWidget : public QWidget
 {
     Q_OBJECT
+    Q_PROPERTY(QColor borderColor READ getBorderColor WRITE setBorderColor)
 
     public:
         explicit AudioMeterWidget(QWidget* parent = 0);
 
-        void configureAudioMeter(int channel);
+        const QColor& getBorderColor() const;
+        void setBorderColor(const QColor& borderColor);
+
+    protected:
+        virtual void paintEvent(QPaintEvent* event);
+        virtual void showEvent(QShowEvent* event);
+        virtual void hideEvent(QHideEvent* event);
+        virtual void timerEvent(QTimerEvent* event);
 
     private:
-        int channel;
+        QString channelKey;
         LibraryModel* model;
         AbstractCommand* command;
+        QColor borderColor;
+        QBasicTimer refreshTimer;
 
-        OscSubscription* audioSubscription;
+        QVector<float> levels;
+        QVector<float> peaks;
+        QVector<float> holds;
 
-        void configureOscSubscriptions();
+        void configureChannelKey(const QString& deviceName);
+        void updateRefreshTimer();
+        void refreshLevels();
+        int getLevelPosition(float level, int top, int height) const;
 
         Q_SLOT void deviceChanged(const DeviceChangedEvent&);
         Q_SLOT void channelChanged(const ChannelChangedEvent&);
         Q_SLOT void emptyRundown(const EmptyRundownEvent&);
         Q_SLOT void rundownItemSelected(const RundownItemSelectedEvent&);
-        Q_SLOT void audioSubscriptionReceived(const QString&, const QList<QVariant>&);
 };
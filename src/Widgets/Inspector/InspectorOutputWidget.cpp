@@ -5,6 +5,7 @@
 #include "DatabaseManager.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
+#include "LibraryManager.h"
 #include "AtemDeviceManager.h"
 #include "TriCasterDeviceManager.h"
 #include "Commands/BlendModeCommand.h"
@@ -84,6 +85,8 @@ InspectorOutputWidget::InspectorOutputWidget(QWidget* parent)
 
     this->comboBoxTarget->lineEdit()->setStyleSheet("background-color: transparent; border-width: 0px;");
 
+    this->targetFilterModel.setFilterCaseSensitivity(Qt::CaseInsensitive);
+
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceRemoved()), this, SLOT(deviceRemoved()));
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
 
@@ -552,77 +555,61 @@ void InspectorOutputWidget::blockAllSignals(bool block)
     this->lineEditRemoteTriggerId->blockSignals(block);
 }
 
-void InspectorOutputWidget::fillTargetCombo(const QString& type, QString deviceName)
+QAbstractItemModel* InspectorOutputWidget::findTargetModel(const QString& type, QString deviceName)
 {
-    this->comboBoxTarget->clear();
-
     if (this->model == NULL)
-        return;
+        return NULL;
 
     if (deviceName.isEmpty())
         deviceName = this->model->getDeviceName();
 
     if (deviceName.isEmpty())
-        return;
+        return NULL;
 
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(deviceName);
     if (device == NULL)
-        return;
+        return NULL;
 
     const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(deviceName);
     if (deviceModel == NULL)
-        return;
+        return NULL;
 
-    QList<LibraryModel> models;
-    if (this->libraryFilter.isEmpty())
-        models = DatabaseManager::getInstance().getLibraryByDeviceId(deviceModel->getId());
-    else
-        models = DatabaseManager::getInstance().getLibraryByDeviceIdAndFilter(deviceModel->getId(), this->libraryFilter);
+    // The targets are shared by all inspectors and kept in sync by the library.
+    QAbstractItemModel* targetModel = LibraryManager::getInstance().getTargetModel(deviceModel->getAddress(), (type == Rundown::IMAGESCROLLER) ? Rundown::STILL : type);
+    if (targetModel == NULL || this->libraryFilter.isEmpty())
+        return targetModel;
 
-    if (models.count() > 0)
-    {
-        foreach (LibraryModel model, models)
-        {
-            if (type == Rundown::MOVIE && model.getType() == Rundown::MOVIE)
-                this->comboBoxTarget->addItem(model.getName());
-            else if (type == Rundown::AUDIO && model.getType() == Rundown::AUDIO)
-                this->comboBoxTarget->addItem(model.getName());
-            else if (type == Rundown::TEMPLATE && model.getType() == Rundown::TEMPLATE)
-                this->comboBoxTarget->addItem(model.getName());
-            else if ((type == Rundown::STILL || type == Rundown::IMAGESCROLLER) && model.getType() == Rundown::STILL)
-                this->comboBoxTarget->addItem(model.getName());
-        }
+    if (this->targetFilterModel.sourceModel() != targetModel)
+        this->targetFilterModel.setSourceModel(targetModel);
 
-        if (this->comboBoxTarget->findText(this->model->getName()))
-        {
-            if (!this->model->getName().isEmpty() &&
-                (this->model->getType() == Rundown::AUDIO || this->model->getType() == Rundown::STILL ||
-                 this->model->getType() == Rundown::IMAGESCROLLER || this->model->getType() == Rundown::TEMPLATE || this->model->getType() == Rundown::MOVIE) &&
-                this->model->getName() != Rundown::DEFAULT_AUDIO_NAME &&
-                this->model->getName() != Rundown::DEFAULT_STILL_NAME &&
-                this->model->getName() != Rundown::DEFAULT_IMAGESCROLLER_NAME &&
-                this->model->getName() != Rundown::DEFAULT_TEMPLATE_NAME &&
-                this->model->getName() != Rundown::DEFAULT_MOVIE_NAME)
-            {
-                this->comboBoxTarget->addItem(this->model->getName());
-            }
-        }
+    QRegExp filter(this->libraryFilter, Qt::CaseInsensitive, QRegExp::FixedString);
+    if (this->targetFilterModel.filterRegExp() != filter)
+        this->targetFilterModel.setFilterRegExp(filter);
 
-        this->comboBoxTarget->setCurrentIndex(this->comboBoxTarget->findText(this->model->getName()));
-    }
-    else
+    return &this->targetFilterModel;
+}
+
+void InspectorOutputWidget::fillTargetCombo(const QString& type, QString deviceName)
+{
+    this->comboBoxTarget->clear();
+
+    QAbstractItemModel* targetModel = findTargetModel(type, deviceName);
+    this->comboBoxTarget->setTargetModel(targetModel);
+
+    if (targetModel == NULL)
+        return;
+
+    // Only the current target is added, the rest are offered by the completer.
+    if (!this->model->getName().isEmpty() &&
+        (this->model->getType() == Rundown::AUDIO || this->model->getType() == Rundown::STILL ||
+         this->model->getType() == Rundown::IMAGESCROLLER || this->model->getType() == Rundown::TEMPLATE || this->model->getType() == Rundown::MOVIE) &&
+        this->model->getName() != Rundown::DEFAULT_AUDIO_NAME &&
+        this->model->getName() != Rundown::DEFAULT_STILL_NAME &&
+        this->model->getName() != Rundown::DEFAULT_IMAGESCROLLER_NAME &&
+        this->model->getName() != Rundown::DEFAULT_TEMPLATE_NAME &&
+        this->model->getName() != Rundown::DEFAULT_MOVIE_NAME)
     {
-        if (!this->model->getName().isEmpty() &&
-            (this->model->getType() == Rundown::AUDIO || this->model->getType() == Rundown::STILL ||
-             this->model->getType() == Rundown::IMAGESCROLLER || this->model->getType() == Rundown::TEMPLATE || this->model->getType() == Rundown::MOVIE) &&
-            this->model->getName() != Rundown::DEFAULT_AUDIO_NAME &&
-            this->model->getName() != Rundown::DEFAULT_STILL_NAME &&
-            this->model->getName() != Rundown::DEFAULT_IMAGESCROLLER_NAME &&
-            this->model->getName() != Rundown::DEFAULT_TEMPLATE_NAME &&
-            this->model->getName() != Rundown::DEFAULT_MOVIE_NAME)
-        {
-            this->comboBoxTarget->addItem(this->model->getName());
-        }
+        this->comboBoxTarget->addItem(this->model->getName());
     }
 
     this->comboBoxTarget->setCurrentIndex(this->comboBoxTarget->findText(this->model->getName()));
@@ -19,6 +19,7 @@
 
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
+#include <QtCore/QSortFilterProxyModel>
 #include <QtCore/QString>
 
 #include <QtWidgets/QWidget>
@@ -35,6 +36,7 @@ class WIDGETS_EXPORT InspectorOutputWidget : public QWidget, Ui::InspectorOutput
         LibraryModel* model;
         QString delayType;
         QString libraryFilter;
+        QSortFilterProxyModel targetFilterModel;
 
         void checkEmptyDevice();
         void checkEmptyAtemDevice();
@@ -43,6 +45,7 @@ class WIDGETS_EXPORT InspectorOutputWidget : public QWidget, Ui::InspectorOutput
         void blockAllSignals(bool block);
 
         void fillTargetCombo(const QString& type, QString deviceName = "");
+        QAbstractItemModel* findTargetModel(const QString& type, QString deviceName);
 
         Q_SLOT void targetChanged(QString);
         Q_SLOT void deviceAdded(CasparDevice&);
@@ -118,68 +118,16 @@
 
 InspectorWidget::InspectorWidget(QWidget* parent)
     : QWidget(parent),
-      masterVolumeMuted(false), disableCommand(false)
+      masterVolumeMuted(false), disableCommand(false), repositoryRundownSelected(false), selectedPanel(-1)
 {
     setupUi(this);
 
     this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(0)), 0, new InspectorMetadataWidget(this));
     this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(1)), 0, new InspectorOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(2)), 0, new InspectorTemplateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(3)), 0, new InspectorMovieWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(4)), 0, new InspectorBlendModeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(5)), 0, new InspectorBrightnessWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(6)), 0, new InspectorContrastWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(7)), 0, new InspectorClipWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(8)), 0, new InspectorFillWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(9)), 0, new InspectorGridWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(10)), 0, new InspectorLevelsWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(11)), 0, new InspectorOpacityWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(12)), 0, new InspectorSaturationWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(13)), 0, new InspectorVolumeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(14)), 0, new InspectorDeckLinkInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(15)), 0, new InspectorGpiOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(16)), 0, new InspectorImageScrollerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(17)), 0, new InspectorFileRecorderWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(18)), 0, new InspectorKeyerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(19)), 0, new InspectorPrintWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(20)), 0, new InspectorClearOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(21)), 0, new InspectorGroupWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(22)), 0, new InspectorSolidColorWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(23)), 0, new InspectorAudioWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(24)), 0, new InspectorStillWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(25)), 0, new InspectorCustomCommandWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(26)), 0, new InspectorChromaWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(27)), 0, new InspectorInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(28)), 0, new InspectorTakeWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(29)), 0, new InspectorAutoWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(30)), 0, new InspectorPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(31)), 0, new InspectorNetworkSourceWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(32)), 0, new InspectorMacroWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(33)), 0, new InspectorOscOutputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(34)), 0, new InspectorAtemInputWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(35)), 0, new InspectorAtemCutWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(36)), 0, new InspectorAtemAutoWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(37)), 0, new InspectorAtemKeyerStateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(38)), 0, new InspectorAtemVideoFormatWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(39)), 0, new InspectorAtemAudioInputStateWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(40)), 0, new InspectorAtemAudioGainWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(41)), 0, new InspectorAtemAudioInputBalanceWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(42)), 0, new InspectorPlayoutCommandWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(43)), 0, new InspectorFadeToBlackWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(44)), 0, new InspectorPanasonicPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(45)), 0, new InspectorPerspectiveWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(46)), 0, new InspectorRotationWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(47)), 0, new InspectorAnchorWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(48)), 0, new InspectorCropWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(49)), 0, new InspectorHttpGetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(50)), 0, new InspectorHttpPostWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(51)), 0, new InspectorHtmlWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(52)), 0, new InspectorRouteChannelWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(53)), 0, new InspectorRouteVideolayerWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(54)), 0, new InspectorSonyPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(55)), 0, new InspectorSpyderPresetWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(56)), 0, new InspectorAtemMacroWidget(this));
-    this->treeWidgetInspector->setItemWidget(new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(57)), 0, new InspectorAtemFadeToBlackWidget(this));
+
+    // The panels of the command types are built the first time an item of their type is selected.
+    for (int i = 2; i < this->treeWidgetInspector->topLevelItemCount(); i++)
+        new QTreeWidgetItem(this->treeWidgetInspector->topLevelItem(i));
 
     this->treeWidgetInspector->expandAll();
 
@@ -193,133 +141,299 @@ InspectorWidget::InspectorWidget(QWidget* parent)
 
 void InspectorWidget::repositoryRundown(const RepositoryRundownEvent& event)
 {
+    this->repositoryRundownSelected = event.getRepositoryRundown();
+
     for (int i = 0; i < this->treeWidgetInspector->topLevelItemCount(); i++)
     {
-        QTreeWidgetItem* item = this->treeWidgetInspector->topLevelItem(i);
-        QWidget* widget = this->treeWidgetInspector->itemWidget(item->child(0), 0);
-
-        widget->setEnabled(!event.getRepositoryRundown());
+        QWidget* widget = getPanel(i, false);
+        if (widget != NULL)
+            widget->setEnabled(!this->repositoryRundownSelected);
     }
 }
 
 void InspectorWidget::rundownItemSelected(const RundownItemSelectedEvent& event)
 {
+    int index = getPanelIndex(event.getCommand());
+
+    // The metadata and output panels are always shown and follow the selection on their own.
+    QWidget* previousPanel = (this->selectedPanel != -1) ? getPanel(this->selectedPanel, false) : NULL;
+    QWidget* panel = (index > 1) ? getPanel(index, true) : NULL;
+
+    // Only the panel shown is connected, the one hidden gets this last selection to let go of its command.
+    if (panel != NULL && panel != previousPanel)
+        QObject::connect(this, SIGNAL(panelItemSelected(const RundownItemSelectedEvent&)), panel, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
+
+    emit panelItemSelected(event);
+
+    if (previousPanel != NULL && previousPanel != panel)
+        QObject::disconnect(this, SIGNAL(panelItemSelected(const RundownItemSelectedEvent&)), previousPanel, SLOT(rundownItemSelected(const RundownItemSelectedEvent&)));
+
+    this->selectedPanel = (panel != NULL) ? index : -1;
+
     setDefaultVisibleWidgets();
 
-    if (dynamic_cast<TemplateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(2)->setHidden(false);
-    else if (dynamic_cast<AudioCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(23)->setHidden(false);
-    else if (dynamic_cast<StillCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(24)->setHidden(false);
-    else if (dynamic_cast<MovieCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(3)->setHidden(false);
-    else if (dynamic_cast<BlendModeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(4)->setHidden(false);
-    else if (dynamic_cast<BrightnessCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(5)->setHidden(false);
-    else if (dynamic_cast<ContrastCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(6)->setHidden(false);
-    else if (dynamic_cast<ClipCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(7)->setHidden(false);
-    else if (dynamic_cast<FillCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(8)->setHidden(false);
-    else if (dynamic_cast<GridCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(9)->setHidden(false);
-    else if (dynamic_cast<KeyerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(18)->setHidden(false);
-    else if (dynamic_cast<CommitCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(1)->setHidden(false);
-    else if (dynamic_cast<LevelsCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(10)->setHidden(false);
-    else if (dynamic_cast<OpacityCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(11)->setHidden(false);
-    else if (dynamic_cast<SaturationCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(12)->setHidden(false);
-    else if (dynamic_cast<VolumeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(13)->setHidden(false);
-    else if (dynamic_cast<GpiOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(15)->setHidden(false);
-    else if (dynamic_cast<DeckLinkInputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(14)->setHidden(false);
-    else if (dynamic_cast<ImageScrollerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(16)->setHidden(false);
-    else if (dynamic_cast<FileRecorderCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(17)->setHidden(false);
-    else if (dynamic_cast<PrintCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(19)->setHidden(false);
-    else if (dynamic_cast<ClearOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(20)->setHidden(false);
-    else if (dynamic_cast<SolidColorCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(22)->setHidden(false);
-    else if (dynamic_cast<GroupCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(21)->setHidden(false);
-    else if (dynamic_cast<CustomCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(25)->setHidden(false);
-    else if (dynamic_cast<ChromaCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(26)->setHidden(false);
-    else if (dynamic_cast<InputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(27)->setHidden(false);
-    else if (dynamic_cast<TakeCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(28)->setHidden(false);
-    else if (dynamic_cast<AutoCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(29)->setHidden(false);
-    else if (dynamic_cast<PresetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(30)->setHidden(false);
-    else if (dynamic_cast<NetworkSourceCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(31)->setHidden(false);
-    else if (dynamic_cast<MacroCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(32)->setHidden(false);
-    else if (dynamic_cast<OscOutputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(33)->setHidden(false);
-    else if (dynamic_cast<AtemInputCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(34)->setHidden(false);
-    else if (dynamic_cast<AtemCutCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(35)->setHidden(false);
-    else if (dynamic_cast<AtemAutoCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(36)->setHidden(false);
-    else if (dynamic_cast<AtemKeyerStateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(37)->setHidden(false);
-    else if (dynamic_cast<AtemVideoFormatCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(38)->setHidden(false);
-    else if (dynamic_cast<AtemAudioInputStateCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(39)->setHidden(false);
-    else if (dynamic_cast<AtemAudioGainCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(40)->setHidden(false);
-    else if (dynamic_cast<AtemAudioInputBalanceCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(41)->setHidden(false);
-    else if (dynamic_cast<PlayoutCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(42)->setHidden(false);
-    else if (dynamic_cast<FadeToBlackCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(43)->setHidden(false);
-    else if (dynamic_cast<PanasonicPresetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(44)->setHidden(false);
-    else if (dynamic_cast<PerspectiveCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(45)->setHidden(false);
-    else if (dynamic_cast<RotationCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(46)->setHidden(false);
-    else if (dynamic_cast<AnchorCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(47)->setHidden(false);
-    else if (dynamic_cast<CropCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(48)->setHidden(false);
-    else if (dynamic_cast<HttpGetCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(49)->setHidden(false);
-    else if (dynamic_cast<HttpPostCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(50)->setHidden(false);
-    else if (dynamic_cast<HtmlCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(51)->setHidden(false);
-    else if (dynamic_cast<RouteChannelCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(52)->setHidden(false);
-    else if (dynamic_cast<RouteVideolayerCommand*>(event.getCommand()))
-        this->treeWidgetInspector->topLevelItem(53)->setHidden(false);
-    else if (dynamic_cast<SonyPresetCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(54)->setHidden(false);
-    else if (dynamic_cast<SpyderPresetCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(55)->setHidden(false);
-    else if (dynamic_cast<AtemMacroCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(56)->setHidden(false);
-    else if (dynamic_cast<AtemFadeToBlackCommand*>(event.getCommand()))
-            this->treeWidgetInspector->topLevelItem(57)->setHidden(false);
+    if (index != -1)
+        this->treeWidgetInspector->topLevelItem(index)->setHidden(false);
+}
+
+int InspectorWidget::getPanelIndex(AbstractCommand* command) const
+{
+    if (dynamic_cast<TemplateCommand*>(command))
+        return 2;
+    else if (dynamic_cast<AudioCommand*>(command))
+        return 23;
+    else if (dynamic_cast<StillCommand*>(command))
+        return 24;
+    else if (dynamic_cast<MovieCommand*>(command))
+        return 3;
+    else if (dynamic_cast<BlendModeCommand*>(command))
+        return 4;
+    else if (dynamic_cast<BrightnessCommand*>(command))
+        return 5;
+    else if (dynamic_cast<ContrastCommand*>(command))
+        return 6;
+    else if (dynamic_cast<ClipCommand*>(command))
+        return 7;
+    else if (dynamic_cast<FillCommand*>(command))
+        return 8;
+    else if (dynamic_cast<GridCommand*>(command))
+        return 9;
+    else if (dynamic_cast<KeyerCommand*>(command))
+        return 18;
+    else if (dynamic_cast<CommitCommand*>(command))
+        return 1;
+    else if (dynamic_cast<LevelsCommand*>(command))
+        return 10;
+    else if (dynamic_cast<OpacityCommand*>(command))
+        return 11;
+    else if (dynamic_cast<SaturationCommand*>(command))
+        return 12;
+    else if (dynamic_cast<VolumeCommand*>(command))
+        return 13;
+    else if (dynamic_cast<GpiOutputCommand*>(command))
+        return 15;
+    else if (dynamic_cast<DeckLinkInputCommand*>(command))
+        return 14;
+    else if (dynamic_cast<ImageScrollerCommand*>(command))
+        return 16;
+    else if (dynamic_cast<FileRecorderCommand*>(command))
+        return 17;
+    else if (dynamic_cast<PrintCommand*>(command))
+        return 19;
+    else if (dynamic_cast<ClearOutputCommand*>(command))
+        return 20;
+    else if (dynamic_cast<SolidColorCommand*>(command))
+        return 22;
+    else if (dynamic_cast<GroupCommand*>(command))
+        return 21;
+    else if (dynamic_cast<CustomCommand*>(command))
+        return 25;
+    else if (dynamic_cast<ChromaCommand*>(command))
+        return 26;
+    else if (dynamic_cast<InputCommand*>(command))
+        return 27;
+    else if (dynamic_cast<TakeCommand*>(command))
+        return 28;
+    else if (dynamic_cast<AutoCommand*>(command))
+        return 29;
+    else if (dynamic_cast<PresetCommand*>(command))
+        return 30;
+    else if (dynamic_cast<NetworkSourceCommand*>(command))
+        return 31;
+    else if (dynamic_cast<MacroCommand*>(command))
+        return 32;
+    else if (dynamic_cast<OscOutputCommand*>(command))
+        return 33;
+    else if (dynamic_cast<AtemInputCommand*>(command))
+        return 34;
+    else if (dynamic_cast<AtemCutCommand*>(command))
+        return 35;
+    else if (dynamic_cast<AtemAutoCommand*>(command))
+        return 36;
+    else if (dynamic_cast<AtemKeyerStateCommand*>(command))
+        return 37;
+    else if (dynamic_cast<AtemVideoFormatCommand*>(command))
+        return 38;
+    else if (dynamic_cast<AtemAudioInputStateCommand*>(command))
+        return 39;
+    else if (dynamic_cast<AtemAudioGainCommand*>(command))
+        return 40;
+    else if (dynamic_cast<AtemAudioInputBalanceCommand*>(command))
+        return 41;
+    else if (dynamic_cast<PlayoutCommand*>(command))
+        return 42;
+    else if (dynamic_cast<FadeToBlackCommand*>(command))
+        return 43;
+    else if (dynamic_cast<PanasonicPresetCommand*>(command))
+        return 44;
+    else if (dynamic_cast<PerspectiveCommand*>(command))
+        return 45;
+    else if (dynamic_cast<RotationCommand*>(command))
+        return 46;
+    else if (dynamic_cast<AnchorCommand*>(command))
+        return 47;
+    else if (dynamic_cast<CropCommand*>(command))
+        return 48;
+    else if (dynamic_cast<HttpGetCommand*>(command))
+        return 49;
+    else if (dynamic_cast<HttpPostCommand*>(command))
+        return 50;
+    else if (dynamic_cast<HtmlCommand*>(command))
+        return 51;
+    else if (dynamic_cast<RouteChannelCommand*>(command))
+        return 52;
+    else if (dynamic_cast<RouteVideolayerCommand*>(command))
+        return 53;
+    else if (dynamic_cast<SonyPresetCommand*>(command))
+        return 54;
+    else if (dynamic_cast<SpyderPresetCommand*>(command))
+        return 55;
+    else if (dynamic_cast<AtemMacroCommand*>(command))
+        return 56;
+    else if (dynamic_cast<AtemFadeToBlackCommand*>(command))
+        return 57;
+
+    return -1;
+}
+
+QWidget* InspectorWidget::getPanel(int index, bool create)
+{
+    QTreeWidgetItem* item = this->treeWidgetInspector->topLevelItem(index)->child(0);
+
+    QWidget* panel = this->treeWidgetInspector->itemWidget(item, 0);
+    if (panel != NULL || !create)
+        return panel;
+
+    panel = createPanel(index);
+    panel->setEnabled(!this->repositoryRundownSelected);
+
+    // Selections are handed to the panel by us while it is shown.
+    QObject::disconnect(&EventManager::getInstance(), SIGNAL(rundownItemSelected(const RundownItemSelectedEvent&)), panel, 0);
+
+    this->treeWidgetInspector->setItemWidget(item, 0, panel);
+
+    return panel;
+}
+
+QWidget* InspectorWidget::createPanel(int index)
+{
+    switch (index)
+    {
+        case 2:
+            return new InspectorTemplateWidget(this);
+        case 3:
+            return new InspectorMovieWidget(this);
+        case 4:
+            return new InspectorBlendModeWidget(this);
+        case 5:
+            return new InspectorBrightnessWidget(this);
+        case 6:
+            return new InspectorContrastWidget(this);
+        case 7:
+            return new InspectorClipWidget(this);
+        case 8:
+            return new InspectorFillWidget(this);
+        case 9:
+            return new InspectorGridWidget(this);
+        case 10:
+            return new InspectorLevelsWidget(this);
+        case 11:
+            return new InspectorOpacityWidget(this);
+        case 12:
+            return new InspectorSaturationWidget(this);
+        case 13:
+            return new InspectorVolumeWidget(this);
+        case 14:
+            return new InspectorDeckLinkInputWidget(this);
+        case 15:
+            return new InspectorGpiOutputWidget(this);
+        case 16:
+            return new InspectorImageScrollerWidget(this);
+        case 17:
+            return new InspectorFileRecorderWidget(this);
+        case 18:
+            return new InspectorKeyerWidget(this);
+        case 19:
+            return new InspectorPrintWidget(this);
+        case 20:
+            return new InspectorClearOutputWidget(this);
+        case 21:
+            return new InspectorGroupWidget(this);
+        case 22:
+            return new InspectorSolidColorWidget(this);
+        case 23:
+            return new InspectorAudioWidget(this);
+        case 24:
+            return new InspectorStillWidget(this);
+        case 25:
+            return new InspectorCustomCommandWidget(this);
+        case 26:
+            return new InspectorChromaWidget(this);
+        case 27:
+            return new InspectorInputWidget(this);
+        case 28:
+            return new InspectorTakeWidget(this);
+        case 29:
+            return new InspectorAutoWidget(this);
+        case 30:
+            return new InspectorPresetWidget(this);
+        case 31:
+            return new InspectorNetworkSourceWidget(this);
+        case 32:
+            return new InspectorMacroWidget(this);
+        case 33:
+            return new InspectorOscOutputWidget(this);
+        case 34:
+            return new InspectorAtemInputWidget(this);
+        case 35:
+            return new InspectorAtemCutWidget(this);
+        case 36:
+            return new InspectorAtemAutoWidget(this);
+        case 37:
+            return new InspectorAtemKeyerStateWidget(this);
+        case 38:
+            return new InspectorAtemVideoFormatWidget(this);
+        case 39:
+            return new InspectorAtemAudioInputStateWidget(this);
+        case 40:
+            return new InspectorAtemAudioGainWidget(this);
+        case 41:
+            return new InspectorAtemAudioInputBalanceWidget(this);
+        case 42:
+            return new InspectorPlayoutCommandWidget(this);
+        case 43:
+            return new InspectorFadeToBlackWidget(this);
+        case 44:
+            return new InspectorPanasonicPresetWidget(this);
+        case 45:
+            return new InspectorPerspectiveWidget(this);
+        case 46:
+            return new InspectorRotationWidget(this);
+        case 47:
+            return new InspectorAnchorWidget(this);
+        case 48:
+            return new InspectorCropWidget(this);
+        case 49:
+            return new InspectorHttpGetWidget(this);
+        case 50:
+            return new InspectorHttpPostWidget(this);
+        case 51:
+            return new InspectorHtmlWidget(this);
+        case 52:
+            return new InspectorRouteChannelWidget(this);
+        case 53:
+            return new InspectorRouteVideolayerWidget(this);
+        case 54:
+            return new InspectorSonyPresetWidget(this);
+        case 55:
+            return new InspectorSpyderPresetWidget(this);
+        case 56:
+            return new InspectorAtemMacroWidget(this);
+        case 57:
+            return new InspectorAtemFadeToBlackWidget(this);
+        default:
+            return NULL;
+    }
 }
 
 void InspectorWidget::setDefaultVisibleWidgets()
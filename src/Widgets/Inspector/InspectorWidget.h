@@ -8,6 +8,8 @@
 #include "Events/Rundown/EmptyRundownEvent.h"
 #include "Events/Rundown/RepositoryRundownEvent.h"
 
+#include "Commands/AbstractCommand.h"
+
 #include <QtCore/QEvent>
 #include <QtCore/QObject>
 
@@ -20,11 +22,18 @@ class WIDGETS_EXPORT InspectorWidget : public QWidget, Ui::InspectorWidget
     public:
         explicit InspectorWidget(QWidget* parent = 0);
 
+        Q_SIGNAL void panelItemSelected(const RundownItemSelectedEvent&);
+
     private:
         bool masterVolumeMuted;
         bool disableCommand;
+        bool repositoryRundownSelected;
+        int selectedPanel;
 
         void setDefaultVisibleWidgets();
+        int getPanelIndex(AbstractCommand* command) const;
+        QWidget* getPanel(int index, bool create);
+        QWidget* createPanel(int index);
 
         Q_SLOT void masterVolumeClicked();
         Q_SLOT void toggleExpandItem(QTreeWidgetItem*, int);
@@ -1,9 +1,51 @@
 #include "TargetComboBaseWidget.h"
 
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QListView>
+
 TargetComboBaseWidget::TargetComboBaseWidget(QWidget* parent)
     : QComboBox(parent),
-      previousText("")
+      previousText(""), targetCompleter(NULL)
+{
+}
+
+void TargetComboBaseWidget::setTargetModel(QAbstractItemModel* model)
+{
+    if (this->lineEdit() == NULL)
+        return;
+
+    if (this->targetCompleter == NULL)
+    {
+        // Uniform rows let the popup lay out only what is visible.
+        QListView* popup = new QListView(this);
+        popup->setUniformItemSizes(true);
+        popup->setLayoutMode(QListView::Batched);
+
+        this->targetCompleter = new QCompleter(this);
+        this->targetCompleter->setPopup(popup);
+        this->targetCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+        this->targetCompleter->setFilterMode(Qt::MatchContains);
+        this->targetCompleter->setCompletionMode(QCompleter::PopupCompletion);
+        this->targetCompleter->setMaxVisibleItems(this->maxVisibleItems());
+
+        // Set on the line edit, the combo box would map completions to its own rows.
+        this->lineEdit()->setCompleter(this->targetCompleter);
+    }
+
+    if (this->targetCompleter->model() != model)
+        this->targetCompleter->setModel(model);
+}
+
+void TargetComboBaseWidget::showPopup()
 {
+    if (this->targetCompleter == NULL || this->targetCompleter->model() == NULL)
+    {
+        QComboBox::showPopup();
+        return;
+    }
+
+    this->targetCompleter->setCompletionPrefix("");
+    this->targetCompleter->complete();
 }
 
 void TargetComboBaseWidget::mousePressEvent(QMouseEvent* event)
@@ -2,12 +2,19 @@
 
 #include "../Shared.h"
 
+#include <QtCore/QAbstractItemModel>
 #include <QtCore/QObject>
 
 #include <QtGui/QMouseEvent>
 
 #include <QtWidgets/QComboBox>
+#include <QtWidgets/QCompleter>
 
+/*
+ * The targets of a device are not added to the combo box, they are shown by a
+ * completer over the shared target model of the library. The combo box only
+ * holds the current target.
+ */
 class WIDGETS_EXPORT TargetComboBaseWidget : public QComboBox
 {
     Q_OBJECT
@@ -17,9 +24,14 @@ class WIDGETS_EXPORT TargetComboBaseWidget : public QComboBox
 
         const QString& getPreviousText() const;
 
+        void setTargetModel(QAbstractItemModel* model);
+
+        virtual void showPopup();
+
     protected:
         virtual void mousePressEvent(QMouseEvent* event);
 
     private:
         QString previousText;
+        QCompleter* targetCompleter;
 };
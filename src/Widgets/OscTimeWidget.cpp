@@ -5,15 +5,20 @@
 #include "DatabaseManager.h"
 #include "Timecode.h"
 
-#include <QtCore/QDateTime>
-#include <QtCore/QTimer>
 #include <QtCore/QDebug>
 
+static const int DISPLAY_INTERVAL = 40;
+static const int MAXIMUM_EXTRAPOLATION = 1000; // The server has stopped reporting when nothing arrived for this long.
+static const int CORRECTION_TIME = 1000; // Long enough that a correction never runs the time backwards.
+static const double MAXIMUM_CORRECTION = 0.5; // Seconds, a larger difference is a seek or a loop and is shown at once.
+
 OscTimeWidget::OscTimeWidget(QWidget* parent)
     : QWidget(parent)
 {
     setupUi(this);
 
+    this->clock.start();
+
     this->setVisible(false);
     this->progressBarOscTime->setVisible(false);
     if (DatabaseManager::getInstance().getConfigurationByName("DisableInAndOutPoints").getValue() == "true")
@@ -45,9 +50,12 @@ void OscTimeWidget::reset()
         return;
 
     this->fps = 0;
-    this->timestamp = 0;
+    this->sampled = false;
+    this->displayedFrame = -1;
     this->progressBarOscTime->reset();
 
+    updateDisplayTimer();
+
     if (this->startTime.isEmpty())
     {
         this->setVisible(false);
@@ -60,30 +68,95 @@ void OscTimeWidget::reset()
     }
 }
 
-void OscTimeWidget::setTime(int currentFrame)
+void OscTimeWidget::setPosition(int currentFrame, int totalFrames)
 {
     if (this->fps == 0)
         return;
 
     this->setVisible(true);
+    this->progressBarOscTime->setVisible(true);
+
+    qint64 time = this->clock.elapsed();
+
+    // The difference to where the clock was is faded out, unless the clip was sought or looped.
+    this->correction = 0;
+    if (this->sampled)
+    {
+        double difference = getFrame(time) - currentFrame;
+        if (qAbs(difference) < MAXIMUM_CORRECTION * this->fps)
+            this->correction = difference;
+    }
+
+    this->sampled = true;
+    this->sampleFrame = currentFrame;
+    this->sampleTime = time;
+    this->totalFrames = totalFrames;
+
+    updateDisplay();
+    updateDisplayTimer();
+}
+
+double OscTimeWidget::getFrame(qint64 time) const
+{
+    qint64 elapsed = time - this->sampleTime;
+
+    double frame = this->sampleFrame;
+    if (!this->paused)
+        frame += qMin(elapsed, qint64(MAXIMUM_EXTRAPOLATION)) * this->fps / 1000.0;
 
-    double currentTime = currentFrame * (1.0 / this->fps);
+    if (elapsed < CORRECTION_TIME)
+        frame += this->correction * (CORRECTION_TIME - elapsed) / CORRECTION_TIME;
 
-    this->labelOscTime->setText(Timecode::fromTime(currentTime, this->fps, this->useDropFrameNotation));
+    return frame;
+}
+
+void OscTimeWidget::updateDisplay()
+{
+    int frame = static_cast<int>(getFrame(this->clock.elapsed()));
+    if (this->totalFrames > 0)
+        frame = qBound(0, frame, this->totalFrames);
+
+    if (frame == this->displayedFrame)
+        return;
+
+    this->displayedFrame = frame;
+
+    this->progressBarOscTime->setValue(frame);
 
-    if (this->timestamp == 0) // First time.
-        QTimer::singleShot(500, this, SLOT(checkState()));
+    int timeFrame = (this->reverseOscTime && frame > 0) ? this->totalFrames - frame : frame;
+    this->labelOscTime->setText(Timecode::fromTime(timeFrame * (1.0 / this->fps), this->fps, this->useDropFrameNotation));
+}
 
-    this->timestamp = QDateTime::currentMSecsSinceEpoch();
+void OscTimeWidget::updateDisplayTimer()
+{
+    // Only a clip that is playing needs to be redrawn between the reports.
+    bool running = this->sampled && !this->paused && this->fps > 0 && this->clock.elapsed() - this->sampleTime < MAXIMUM_EXTRAPOLATION + CORRECTION_TIME;
+    if (running && !this->displayTimer.isActive())
+        this->displayTimer.start(DISPLAY_INTERVAL, this);
+    else if (!running && this->displayTimer.isActive())
+        this->displayTimer.stop();
+}
+
+void OscTimeWidget::timerEvent(QTimerEvent* event)
+{
+    if (event->timerId() != this->displayTimer.timerId())
+    {
+        QWidget::timerEvent(event);
+        return;
+    }
+
+    updateDisplay();
+    updateDisplayTimer();
 }
 
 void OscTimeWidget::setStartTime(const QString& startTime, bool reverseOscTime)
 {
+    this->reverseOscTime = reverseOscTime;
+
     if (startTime.isEmpty())
         return;
 
     this->startTime = startTime;
-    this->reverseOscTime = reverseOscTime;
     this->labelOscTime->setText(this->startTime);
 
     if (this->reverseOscTime)
@@ -108,18 +181,6 @@ void OscTimeWidget::setInOutTime(int seek, int length)
     this->progressBarOscTime->setRange(seek, seek + length);
 }
 
-void OscTimeWidget::setProgress(int currentFrame)
-{
-    if (this->fps == 0)
-        return;
-
-    this->setVisible(true);
-
-    this->progressBarOscTime->setVisible(true);
-    this->progressBarOscTime->setValue(currentFrame);
-    this->progressBarOscTime->update();
-}
-
 void OscTimeWidget::setFramesPerSecond(double fps)
 {
     this->fps = fps;
@@ -130,8 +191,19 @@ void OscTimeWidget::setPaused(bool paused)
     if (this->fps == 0)
         return; // We are not playing.
 
+    if (paused != this->paused && this->sampled)
+    {
+        // The clock continues or stops from where it is shown.
+        qint64 time = this->clock.elapsed();
+        this->sampleFrame = getFrame(time);
+        this->sampleTime = time;
+        this->correction = 0;
+    }
+
     this->paused = paused;
 
+    updateDisplayTimer();
+
     if (this->paused && !this->progressBarOscTime->isVisible())
         this->progressBarOscTime->setVisible(true);
 }
@@ -141,20 +213,6 @@ void OscTimeWidget::setLoop(bool loop)
     Q_UNUSED(loop);
 }
 
-void OscTimeWidget::checkState()
-{
-    qint64 currentTimestamp = QDateTime::currentMSecsSinceEpoch();
-
-    if (!this->paused && (currentTimestamp - this->timestamp) >= 500)
-    {
-        reset();
-
-        return;
-    }
-
-    QTimer::singleShot(500, this, SLOT(checkState()));
-}
-
 void OscTimeWidget::setCompactView(bool compactView)
 {
     if (compactView)
@@ -3,8 +3,17 @@
 #include "Shared.h"
 #include "ui_OscTimeWidget.h"
 
+#include <QtCore/QBasicTimer>
+#include <QtCore/QElapsedTimer>
+
 #include <QtWidgets/QWidget>
 
+/*
+ * Shows the time and progress of a playing clip. The position is extrapolated
+ * from the last frame reported by the server, so the time runs at display
+ * rate between the batched OSC updates. A new report that differs from the
+ * extrapolated position is faded in instead of making the time jump.
+ */
 class WIDGETS_EXPORT OscTimeWidget : public QWidget, Ui::OscTimeWidget
 {
     Q_OBJECT
@@ -13,24 +22,36 @@ class WIDGETS_EXPORT OscTimeWidget : public QWidget, Ui::OscTimeWidget
         explicit OscTimeWidget(QWidget* parent = 0);
 
         void reset();
-        void setTime(int currentFrame);
+        void setPosition(int currentFrame, int totalFrames);
         void setStartTime(const QString& startTime, bool reverseOscTime);
         void setInOutTime(int seek, int length);
-        void setProgress(int currentFrame);
         void setFramesPerSecond(double fps);
         void setPaused(bool paused);
         void setLoop(bool loop);
 
         void setCompactView(bool compactView);
 
+    protected:
+        virtual void timerEvent(QTimerEvent* event);
+
     private:
         double fps = 0;
         bool paused = false;
         bool reverseOscTime = false;
         bool useDropFrameNotation = false;
 
-        qint64 timestamp = 0;
         QString startTime = "";
 
-        Q_SLOT void checkState();
+        bool sampled = false;
+        int totalFrames = 0;
+        int displayedFrame = -1;
+        double sampleFrame = 0;
+        double correction = 0;
+        qint64 sampleTime = 0;
+        QElapsedTimer clock;
+        QBasicTimer displayTimer;
+
+        double getFrame(qint64 time) const;
+        void updateDisplay();
+        void updateDisplayTimer();
 };
@@ -32,5 +32,16 @@ class WIDGETS_EXPORT AbstractRundownWidget : public AbstractProperties
         virtual void setExpanded(bool expanded) = 0;
         virtual void clearDelayedCommands() = 0;
         virtual void setUsed(bool used) = 0;
+        virtual bool isUsed() const = 0;
         virtual void setSelected(bool selected) = 0;
+
+        // Items off screen may defer or release resources like thumbnails.
+        virtual void setInViewport(bool /* inViewport */) {}
+
+        // Playable items may be loaded into the background of their layer ahead of the take.
+        virtual bool executePreroll() { return false; }
+        virtual void releasePreroll() {}
+
+        // Items playing or on air keep their widget while the rundown is hibernated.
+        virtual bool isLive() const { return false; }
 };
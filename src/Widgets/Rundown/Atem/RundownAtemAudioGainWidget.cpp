@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "AtemDeviceManager.h"
 #include "GpiManager.h"
@@ -230,6 +231,8 @@ void RundownAtemAudioGainWidget::clearDelayedCommands()
 
 void RundownAtemAudioGainWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -244,6 +247,11 @@ void RundownAtemAudioGainWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownAtemAudioGainWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownAtemAudioGainWidget::executeCommand(Playout::PlayoutType type)
 {
     if ((type == Playout::PlayoutType::Play && !this->command.getTriggerOnNext()) || type == Playout::PlayoutType::Update)
@@ -252,7 +260,7 @@ bool RundownAtemAudioGainWidget::executeCommand(Playout::PlayoutType type)
             return true;
 
         if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-            QTimer::singleShot(this->command.getDelay(), this, SLOT(executePlay()));
+            CommandScheduler::getInstance().singleShot(this->command.getDelay(), this, SLOT(executePlay()));
     }
     else if (type == Playout::PlayoutType::PlayNow)
         executePlay();
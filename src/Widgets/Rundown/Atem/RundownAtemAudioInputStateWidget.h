@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -54,6 +55,7 @@ class WIDGETS_EXPORT RundownAtemAudioInputStateWidget : public QWidget, Ui::Rund
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     private:
@@ -66,12 +68,13 @@ class WIDGETS_EXPORT RundownAtemAudioInputStateWidget : public QWidget, Ui::Rund
         ActiveAnimation* animation;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* playControlSubscription;
         OscSubscription* playNowControlSubscription;
         OscSubscription* updateControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
 
         void checkEmptyDevice();
         void checkGpiConnection();
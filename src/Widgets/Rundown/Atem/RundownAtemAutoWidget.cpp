@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "AtemDeviceManager.h"
 #include "GpiManager.h"
@@ -232,6 +233,8 @@ void RundownAtemAutoWidget::clearDelayedCommands()
 
 void RundownAtemAutoWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -246,6 +249,11 @@ void RundownAtemAutoWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownAtemAutoWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownAtemAutoWidget::executeCommand(Playout::PlayoutType type)
 {
     if ((type == Playout::PlayoutType::Play && !this->command.getTriggerOnNext()) || type == Playout::PlayoutType::Update)
@@ -254,7 +262,7 @@ bool RundownAtemAutoWidget::executeCommand(Playout::PlayoutType type)
             return true;
 
         if (!this->model.getDeviceName().isEmpty()) // The user need to select a device.
-            QTimer::singleShot(this->command.getDelay(), this, SLOT(executePlay()));
+            CommandScheduler::getInstance().singleShot(this->command.getDelay(), this, SLOT(executePlay()));
     }
     else if (type == Playout::PlayoutType::PlayNow)
         executePlay();
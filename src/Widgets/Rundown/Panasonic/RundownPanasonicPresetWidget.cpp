@@ -173,6 +173,8 @@ void RundownPanasonicPresetWidget::clearDelayedCommands()
 
 void RundownPanasonicPresetWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -187,6 +189,11 @@ void RundownPanasonicPresetWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownPanasonicPresetWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownPanasonicPresetWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -51,6 +52,7 @@ class WIDGETS_EXPORT RundownPanasonicPresetWidget : public QWidget, Ui::RundownP
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     private:
@@ -63,6 +65,7 @@ class WIDGETS_EXPORT RundownPanasonicPresetWidget : public QWidget, Ui::RundownP
         ActiveAnimation* animation;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -72,7 +75,7 @@ class WIDGETS_EXPORT RundownPanasonicPresetWidget : public QWidget, Ui::RundownP
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
         PtzDevice* device;
 
         void checkGpiConnection();
@@ -4,6 +4,7 @@
 
 #include "DeviceManager.h"
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "GpiManager.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
@@ -237,6 +238,8 @@ void RundownAnchorWidget::clearDelayedCommands()
 
 void RundownAnchorWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -251,6 +254,11 @@ void RundownAnchorWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownAnchorWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownAnchorWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -270,21 +278,18 @@ bool RundownAnchorWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStop()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executeTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
             }
 
             this->executeTimer.start();
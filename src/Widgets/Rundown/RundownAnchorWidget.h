@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -53,6 +54,7 @@ class WIDGETS_EXPORT RundownAnchorWidget : public QWidget, Ui::RundownAnchorWidg
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     private:
@@ -66,6 +68,7 @@ class WIDGETS_EXPORT RundownAnchorWidget : public QWidget, Ui::RundownAnchorWidg
         QString delayType;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -76,7 +79,7 @@ class WIDGETS_EXPORT RundownAnchorWidget : public QWidget, Ui::RundownAnchorWidg
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
 
         void checkEmptyDevice();
         void checkGpiConnection();
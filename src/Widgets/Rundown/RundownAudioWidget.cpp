@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "EventManager.h"
 #include "GpiManager.h"
@@ -251,6 +252,8 @@ void RundownAudioWidget::clearDelayedCommands()
 
 void RundownAudioWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -265,6 +268,11 @@ void RundownAudioWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownAudioWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownAudioWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -291,14 +299,11 @@ bool RundownAudioWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeStartTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeStartTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    this->executeStopTimer.setInterval(startDelay + stopDelay);
-                }
+                    this->executeStopTimer.setFrameInterval(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock);
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
@@ -339,18 +344,16 @@ void RundownAudioWidget::executeStop()
     this->executeStartTimer.stop();
     this->executeStopTimer.stop();
 
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Stop);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     this->paused = false;
@@ -360,40 +363,16 @@ void RundownAudioWidget::executeStop()
 
 void RundownAudioWidget::executePlay()
 {
+    const QByteArray& message = this->command.getAmcpMessage((this->loaded == true) ? AbstractCommand::AmcpMessage::PlayLoaded : AbstractCommand::AmcpMessage::Play);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-        {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        }
-        else
-        {
-            device->playAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-        }
-    }
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                deviceShadow->playAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-            }
-        }
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     if (this->markUsedItems)
@@ -438,26 +417,16 @@ void RundownAudioWidget::executePause()
 
 void RundownAudioWidget::executeLoad()
 {
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Load);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-    {
-        device->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-    }
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadAudio(this->command.getChannel(), this->command.getVideolayer(), this->command.getAudioName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getLoop(), this->command.getUseAuto());
-        }
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     this->loaded = true;
@@ -0,0 +1,276 @@
+#include "RundownAutoPlayQueue.h"
+
+#include "Global.h"
+
+#include "CommandScheduler.h"
+#include "DeviceManager.h"
+#include "StageStateManager.h"
+#include "Commands/AbstractPlayoutCommand.h"
+#include "Commands/MovieCommand.h"
+
+#include <QtCore/QtMath>
+
+static const qint64 PRETRIGGER_LOOKAHEAD = 2000000000; // Armed well ahead of the last stage update before the deadline.
+
+RundownAutoPlayQueue::RundownAutoPlayQueue(int pretriggerFrames, QObject* parent)
+    : QObject(parent),
+      pretriggerFrames(pretriggerFrames), onAir(false), triggered(false), expectedTransition(-1), stageSubscription(NULL)
+{
+    this->pretriggerTimer.setSingleShot(true);
+    QObject::connect(&this->pretriggerTimer, SIGNAL(timeout()), this, SLOT(pretrigger()));
+}
+
+void RundownAutoPlayQueue::append(AbstractRundownWidget* widget)
+{
+    this->widgets.append(widget);
+}
+
+void RundownAutoPlayQueue::remove(AbstractRundownWidget* widget)
+{
+    int index = this->widgets.indexOf(widget);
+    if (index < 0)
+        return;
+
+    this->widgets.removeAt(index);
+
+    if (index == 0)
+    {
+        // The item on air is gone, wait for whatever plays next on its layer.
+        this->onAir = false;
+        this->triggered = false;
+        this->pretriggerTimer.stop();
+
+        updateStageSubscription();
+    }
+    else if (index == 1)
+    {
+        this->triggered = false;
+    }
+
+    if (this->widgets.isEmpty())
+        finish();
+}
+
+bool RundownAutoPlayQueue::contains(AbstractRundownWidget* widget) const
+{
+    return this->widgets.contains(widget);
+}
+
+bool RundownAutoPlayQueue::isEmpty() const
+{
+    return this->widgets.isEmpty();
+}
+
+const QList<AbstractRundownWidget*>& RundownAutoPlayQueue::getWidgets() const
+{
+    return this->widgets;
+}
+
+AbstractRundownWidget* RundownAutoPlayQueue::getCurrentWidget() const
+{
+    return this->widgets.isEmpty() ? NULL : this->widgets.first();
+}
+
+void RundownAutoPlayQueue::start()
+{
+    this->onAir = false;
+    this->triggered = false;
+    this->expectedTransition = -1;
+
+    updateStageSubscription();
+}
+
+void RundownAutoPlayQueue::next()
+{
+    if (this->widgets.count() < 2)
+        return;
+
+    // Played right away, a background queued by LOADBG AUTO is replaced.
+    this->pretriggerTimer.stop();
+    this->expectedTransition = -1;
+
+    trigger(false);
+}
+
+void RundownAutoPlayQueue::trigger(bool queued)
+{
+    AbstractRundownWidget* widget = this->widgets.at(1);
+    dynamic_cast<AbstractPlayoutCommand*>(widget)->executeCommand((queued == true) ? Playout::PlayoutType::Play : Playout::PlayoutType::Next);
+
+    this->triggered = true;
+}
+
+void RundownAutoPlayQueue::finish()
+{
+    this->widgets.clear();
+    this->pretriggerTimer.stop();
+
+    if (this->stageSubscription != NULL)
+    {
+        this->stageSubscription->disconnect(); // Disconnect all events.
+        this->stageSubscription->deleteLater();
+        this->stageSubscription = NULL;
+    }
+
+    emit finished();
+}
+
+void RundownAutoPlayQueue::updateStageSubscription()
+{
+    if (this->widgets.isEmpty())
+        return;
+
+    AbstractRundownWidget* widget = this->widgets.first();
+
+    QString key;
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(widget->getLibraryModel()->getDeviceName());
+    if (device != NULL)
+    {
+        key = StageStateManager::getLayerKey(device->resolveIpAddress(), widget->getCommand()->getChannel(), widget->getCommand()->getVideolayer());
+        this->frameClock = CommandScheduler::getFrameClock(widget->getLibraryModel()->getDeviceName(), widget->getCommand()->getChannel());
+    }
+
+    if (this->stageSubscription != NULL && this->stageSubscription->getKey() == key)
+        return;
+
+    if (this->stageSubscription != NULL)
+    {
+        this->stageSubscription->disconnect(); // Disconnect all events.
+        this->stageSubscription->deleteLater();
+        this->stageSubscription = NULL;
+    }
+
+    if (key.isEmpty())
+        return;
+
+    this->stageSubscription = new StageStateSubscription(key, this);
+    QObject::connect(this->stageSubscription, SIGNAL(layerChanged(const OscLayerModel&)), this, SLOT(stageStateChanged(const OscLayerModel&)));
+}
+
+bool RundownAutoPlayQueue::isOnAir(AbstractRundownWidget* widget, const OscLayerModel& layer) const
+{
+    if (!layer.isActive())
+        return false;
+
+    QString name = layer.getPath();
+    name.remove(name.lastIndexOf('.'), name.length()); // Remove extension.
+
+    return widget->getLibraryModel()->getName().toLower() == name.toLower();
+}
+
+int RundownAutoPlayQueue::getEndFrame(AbstractRundownWidget* widget, const OscLayerModel& layer) const
+{
+    MovieCommand* command = dynamic_cast<MovieCommand*>(widget->getCommand());
+    if (command != NULL && command->getLength() > 0)
+        return qMin(layer.getTotalFrames(), command->getSeek() + command->getLength());
+
+    return layer.getTotalFrames();
+}
+
+void RundownAutoPlayQueue::pretrigger()
+{
+    if (this->widgets.count() > 1 && this->onAir && !this->triggered)
+        trigger(false);
+}
+
+void RundownAutoPlayQueue::stageStateChanged(const OscLayerModel& layer)
+{
+    if (this->widgets.isEmpty())
+        return;
+
+    AbstractRundownWidget* widget = this->widgets.first();
+    if (!isOnAir(widget, layer))
+    {
+        if (!this->onAir)
+            return; // Not started yet.
+
+        this->pretriggerTimer.stop();
+
+        // Stopped or replaced by the operator, the rest of the queue is dropped.
+        if (!this->triggered)
+        {
+            finish();
+            return;
+        }
+
+        this->widgets.removeFirst();
+        this->onAir = false;
+        this->triggered = false;
+
+        QString key = (this->stageSubscription != NULL) ? this->stageSubscription->getKey() : QString();
+        updateStageSubscription();
+
+        // The next item usually is on air in the same update.
+        if (this->stageSubscription != NULL && this->stageSubscription->getKey() == key)
+            stageStateChanged(layer);
+
+        return;
+    }
+
+    double framesPerSecond = layer.getFramesPerSecond();
+    if (framesPerSecond <= 0)
+        return;
+
+    // The frame was reported when it was received, not when the batch holding it is processed.
+    qint64 time = layer.getFrameReceipt();
+    if (time < 0)
+        return;
+
+    double period = 1000000000.0 / framesPerSecond;
+
+    if (!this->onAir)
+    {
+        this->onAir = true;
+
+        if (this->expectedTransition >= 0)
+        {
+            MovieCommand* command = dynamic_cast<MovieCommand*>(widget->getCommand());
+            int seek = (command != NULL) ? command->getSeek() : 0;
+
+            qint64 started = time - qRound64((layer.getFrame() - seek) * period);
+            qint64 offset = started - this->expectedTransition;
+
+            qDebug("AutoPlay transition to %s was %lld frames (%lld us) off the expected frame",
+                   qPrintable(widget->getLibraryModel()->getName()), qRound64(offset / period), offset / 1000);
+        }
+
+        this->expectedTransition = -1;
+
+        if (this->pretriggerFrames == 0 && this->widgets.count() > 1)
+            trigger(true);
+    }
+
+    if (this->widgets.count() < 2 || layer.getLoop())
+        return;
+
+    int remaining = getEndFrame(widget, layer) - layer.getFrame();
+    if (this->pretriggerFrames > 0)
+    {
+        if (this->triggered)
+            return;
+
+        if (layer.getPaused())
+        {
+            this->pretriggerTimer.stop();
+            return;
+        }
+
+        int frames = remaining - this->pretriggerFrames;
+        this->expectedTransition = time + qRound64(qMax(frames, 0) * period);
+
+        // Frames that went by while the report waited for its batch are already behind us.
+        frames -= qCeil((CommandScheduler::getInstance().getTime() - time) / period);
+
+        if (frames <= 0)
+            pretrigger();
+        else if (!this->pretriggerTimer.isActive() && frames * period < PRETRIGGER_LOOKAHEAD)
+        {
+            this->pretriggerTimer.setFrameInterval(frames, framesPerSecond, this->frameClock);
+            this->pretriggerTimer.start();
+        }
+    }
+    else
+    {
+        this->expectedTransition = time + qRound64(qMax(remaining, 0) * period);
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../Shared.h"
+#include "AbstractRundownWidget.h"
+
+#include "ScheduledTimer.h"
+#include "StageStateSubscription.h"
+#include "Models/OscLayerModel.h"
+
+#include <QtCore/QList>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+/*
+ * Works through the AutoPlay items of a group on the frame counter the server
+ * reports for the layer on air. The next item is either queued with LOADBG
+ * AUTO as soon as the current one is on air, or played a number of frames
+ * before the current one ends. Every transition is logged against the frame
+ * it was expected on. The queue finishes when its last item leaves the layer.
+ */
+class WIDGETS_EXPORT RundownAutoPlayQueue : public QObject
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownAutoPlayQueue(int pretriggerFrames, QObject* parent = 0);
+
+        void append(AbstractRundownWidget* widget);
+        void remove(AbstractRundownWidget* widget);
+        bool contains(AbstractRundownWidget* widget) const;
+        bool isEmpty() const;
+
+        const QList<AbstractRundownWidget*>& getWidgets() const;
+        AbstractRundownWidget* getCurrentWidget() const;
+
+        void start();
+        void next();
+
+        Q_SIGNAL void finished();
+
+    private:
+        int pretriggerFrames;
+        QList<AbstractRundownWidget*> widgets;
+        bool onAir;
+        bool triggered;
+        qint64 expectedTransition;
+        QString frameClock;
+        StageStateSubscription* stageSubscription;
+        ScheduledTimer pretriggerTimer;
+
+        void trigger(bool queued);
+        void finish();
+        void updateStageSubscription();
+        bool isOnAir(AbstractRundownWidget* widget, const OscLayerModel& layer) const;
+        int getEndFrame(AbstractRundownWidget* widget, const OscLayerModel& layer) const;
+
+        Q_SLOT void pretrigger();
+        Q_SLOT void stageStateChanged(const OscLayerModel&);
+};
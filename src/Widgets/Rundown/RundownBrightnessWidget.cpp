@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -235,6 +236,8 @@ void RundownBrightnessWidget::clearDelayedCommands()
 
 void RundownBrightnessWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -249,6 +252,11 @@ void RundownBrightnessWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownBrightnessWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownBrightnessWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -268,21 +276,18 @@ bool RundownBrightnessWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStop()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executeTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
             }
 
             this->executeTimer.start();
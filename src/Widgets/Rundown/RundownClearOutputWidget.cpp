@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -218,6 +219,8 @@ void RundownClearOutputWidget::clearDelayedCommands()
 
 void RundownClearOutputWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -232,6 +235,11 @@ void RundownClearOutputWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownClearOutputWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownClearOutputWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -259,7 +267,7 @@ bool RundownClearOutputWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                this->executeTimer.setInterval(floor(this->command.getDelay() * (1000 / framesPerSecond)));
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
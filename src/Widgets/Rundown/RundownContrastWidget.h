@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -53,6 +54,7 @@ class WIDGETS_EXPORT RundownContrastWidget : public QWidget, Ui::RundownContrast
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
     virtual void setSelected(bool selected);
 
     private:
@@ -66,6 +68,7 @@ class WIDGETS_EXPORT RundownContrastWidget : public QWidget, Ui::RundownContrast
         QString delayType;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -75,7 +78,7 @@ class WIDGETS_EXPORT RundownContrastWidget : public QWidget, Ui::RundownContrast
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
 
         void checkEmptyDevice();
         void checkGpiConnection();
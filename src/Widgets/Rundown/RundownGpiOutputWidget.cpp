@@ -173,6 +173,8 @@ void RundownGpiOutputWidget::clearDelayedCommands()
 
 void RundownGpiOutputWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -187,6 +189,11 @@ void RundownGpiOutputWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownGpiOutputWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownGpiOutputWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
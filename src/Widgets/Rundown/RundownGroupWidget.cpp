@@ -173,6 +173,8 @@ void RundownGroupWidget::setActive(bool active)
 
 void RundownGroupWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -187,6 +189,11 @@ void RundownGroupWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownGroupWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownGroupWidget::executeCommand(Playout::PlayoutType type)
 {
     if (this->active)
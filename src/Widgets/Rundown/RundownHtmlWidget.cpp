@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -50,13 +51,17 @@ RundownHtmlWidget::RundownHtmlWidget(const LibraryModel& model, QWidget* parent,
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(changed()), this, SLOT(commandChanged()));
     QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
 
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(device.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -88,7 +93,13 @@ void RundownHtmlWidget::deviceChanged(const DeviceChangedEvent& event)
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<CasparDevice> oldDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
+
+        // The page loaded on the old device can't be played on the new one.
+        releasePreroll();
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -97,7 +108,10 @@ void RundownHtmlWidget::deviceChanged(const DeviceChangedEvent& event)
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<CasparDevice> newDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
     }
 
     checkEmptyDevice();
@@ -231,6 +245,8 @@ void RundownHtmlWidget::clearDelayedCommands()
 
 void RundownHtmlWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -245,6 +261,11 @@ void RundownHtmlWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownHtmlWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownHtmlWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -271,14 +292,11 @@ bool RundownHtmlWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeStartTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeStartTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    this->executeStopTimer.setInterval(startDelay + stopDelay);
-                }
+                    this->executeStopTimer.setFrameInterval(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock);
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
@@ -490,6 +508,48 @@ void RundownHtmlWidget::executeLoadPreview()
     }
 }
 
+bool RundownHtmlWidget::executePreroll()
+{
+    // Only an idle item is loaded ahead, items using AUTO wait for the page in front of them.
+    if (this->playing || this->command.getUseAuto())
+        return false;
+
+    if (this->loaded)
+        return true;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device == NULL || !device->isConnected())
+        return false;
+
+    // Always into the background, what is on air is left untouched until the item is played.
+    device->loadHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
+                     this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                     this->command.getDirection(), false, false);
+
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        if (model.getShadow() == "No")
+            continue;
+
+        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
+        if (deviceShadow != NULL && deviceShadow->isConnected())
+            deviceShadow->loadHtml(this->command.getChannel(), this->command.getVideolayer(), this->command.getUrl(),
+                                   this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                                   this->command.getDirection(), false, false);
+    }
+
+    // The next play takes the loaded page instead of opening it again.
+    this->loaded = true;
+
+    return true;
+}
+
+void RundownHtmlWidget::releasePreroll()
+{
+    if (!this->playing)
+        this->loaded = false;
+}
+
 void RundownHtmlWidget::executeClearVideolayer()
 {
     this->executeStartTimer.stop();
@@ -716,17 +776,38 @@ void RundownHtmlWidget::remoteTriggerIdChanged(const QString& remoteTriggerId)
     this->labelRemoteTriggerId->setText(QString("UID: %1").arg(remoteTriggerId));
 }
 
+void RundownHtmlWidget::commandChanged()
+{
+    // The loaded page no longer matches the item, it's loaded again as edited.
+    releasePreroll();
+}
+
 void RundownHtmlWidget::deviceConnectionStateChanged(CasparDevice& device)
 {
     Q_UNUSED(device);
 
+    // The background is gone with the connection, or with the server if it was restarted.
+    releasePreroll();
+
     checkDeviceConnection();
 }
 
+void RundownHtmlWidget::deviceLayerCleared(int channel, int videolayer, CasparDevice& device)
+{
+    Q_UNUSED(device);
+
+    // Cleared by any item, the loaded page is opened again when played.
+    if (channel == this->command.getChannel() && (videolayer == -1 || videolayer == this->command.getVideolayer()))
+        releasePreroll();
+}
+
 void RundownHtmlWidget::deviceAdded(CasparDevice& device)
 {
     if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress())->getName() == this->model.getDeviceName())
+    {
         QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(&device, SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     checkDeviceConnection();
 }
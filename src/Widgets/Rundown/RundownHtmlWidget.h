@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -53,7 +54,10 @@ class WIDGETS_EXPORT RundownHtmlWidget : public QWidget, Ui::RundownHtmlWidget,
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
+        virtual bool executePreroll();
+        virtual void releasePreroll();
 
     private:
         bool active;
@@ -69,6 +73,7 @@ class WIDGETS_EXPORT RundownHtmlWidget : public QWidget, Ui::RundownHtmlWidget,
         QString delayType;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -81,8 +86,8 @@ class WIDGETS_EXPORT RundownHtmlWidget : public QWidget, Ui::RundownHtmlWidget,
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeStartTimer;
-        QTimer executeStopTimer;
+        ScheduledTimer executeStartTimer;
+        ScheduledTimer executeStopTimer;
 
         void checkEmptyDevice();
         void checkGpiConnection();
@@ -102,7 +107,9 @@ class WIDGETS_EXPORT RundownHtmlWidget : public QWidget, Ui::RundownHtmlWidget,
         Q_SLOT void allowGpiChanged(bool);
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
+        Q_SLOT void commandChanged();
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void deviceLayerCleared(int, int, CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
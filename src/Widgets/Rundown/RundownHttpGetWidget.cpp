@@ -182,6 +182,8 @@ void RundownHttpGetWidget::clearDelayedCommands()
 
 void RundownHttpGetWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -196,6 +198,11 @@ void RundownHttpGetWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownHttpGetWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownHttpGetWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
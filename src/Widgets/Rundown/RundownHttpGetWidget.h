@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -51,6 +52,7 @@ class WIDGETS_EXPORT RundownHttpGetWidget : public QWidget, Ui::RundownHttpGetWi
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     protected:
@@ -66,6 +68,7 @@ class WIDGETS_EXPORT RundownHttpGetWidget : public QWidget, Ui::RundownHttpGetWi
         ActiveAnimation* animation;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -75,7 +78,7 @@ class WIDGETS_EXPORT RundownHttpGetWidget : public QWidget, Ui::RundownHttpGetWi
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
         HttpRequest request;
 
         void checkGpiConnection();
@@ -182,6 +182,8 @@ void RundownHttpPostWidget::clearDelayedCommands()
 
 void RundownHttpPostWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -196,6 +198,11 @@ void RundownHttpPostWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownHttpPostWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownHttpPostWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
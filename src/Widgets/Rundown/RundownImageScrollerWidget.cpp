@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -31,7 +32,6 @@ RundownImageScrollerWidget::RundownImageScrollerWidget(const LibraryModel& model
     this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
     this->markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
 
-    setThumbnail();
     setColor(this->color);
     setActive(this->active);
     setCompactView(this->compactView);
@@ -198,6 +198,8 @@ LibraryModel* RundownImageScrollerWidget::getLibraryModel()
 
 void RundownImageScrollerWidget::setThumbnail()
 {
+    this->thumbnailLoaded = true;
+
     if (this->model.getType() == "AUDIO")
     {
         this->labelThumbnail->setVisible(false);
@@ -226,6 +228,15 @@ void RundownImageScrollerWidget::setSelected(bool selected)
     this->selected = selected;
 }
 
+void RundownImageScrollerWidget::setInViewport(bool inViewport)
+{
+    this->inViewport = inViewport;
+
+    // Thumbnails are decoded the first time the item is scrolled into view.
+    if (this->inViewport && !this->thumbnailLoaded)
+        setThumbnail();
+}
+
 void RundownImageScrollerWidget::setActive(bool active)
 {
     this->active = active;
@@ -274,6 +285,8 @@ void RundownImageScrollerWidget::clearDelayedCommands()
 
 void RundownImageScrollerWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL || this->labelThumbnail->graphicsEffect() == NULL)
@@ -295,6 +308,11 @@ void RundownImageScrollerWidget::setUsed(bool used)
     }
 }
 
+bool RundownImageScrollerWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownImageScrollerWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -314,21 +332,18 @@ bool RundownImageScrollerWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStop()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executeTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
             }
 
             this->executeTimer.start();
@@ -0,0 +1,60 @@
+#include "RundownItemDelegate.h"
+#include "RundownTreeBaseWidget.h"
+
+#include "Global.h"
+
+#include <QtCore/QRegExp>
+
+#include <QtGui/QColor>
+#include <QtGui/QFontMetrics>
+
+RundownItemDelegate::RundownItemDelegate(RundownTreeBaseWidget* treeWidget)
+    : QStyledItemDelegate(treeWidget),
+      treeWidget(treeWidget)
+{
+}
+
+void RundownItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    // Rows with a widget are drawn by the widget.
+    if (this->treeWidget->indexWidget(index) != NULL)
+    {
+        QStyledItemDelegate::paint(painter, option, index);
+        return;
+    }
+
+    painter->save();
+
+    QColor color = parseColor(index.data(Rundown::COLOR_ROLE).toString());
+    if (color.isValid() && color.alpha() > 0)
+        painter->fillRect(option.rect, color);
+
+    // Placed roughly where the widget shows its label, next to the icon.
+    QRect rect = option.rect.adjusted(Rundown::DEFAULT_ICON_WIDTH + 8, 0, -4, 0);
+    QString label = option.fontMetrics.elidedText(index.data(Rundown::LABEL_ROLE).toString(), Qt::ElideRight, rect.width());
+
+    painter->setPen(option.palette.color(QPalette::Text));
+    painter->drawText(rect, Qt::AlignLeft | Qt::AlignVCenter, label);
+
+    painter->restore();
+}
+
+QSize RundownItemDelegate::sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+    Q_UNUSED(index);
+
+    // Every row has the fixed height of its widget, whether the widget exists or not.
+    int height = (this->treeWidget->getCompactView() == true) ? Rundown::COMPACT_ITEM_HEIGHT : Rundown::DEFAULT_ITEM_HEIGHT;
+
+    return QSize(option.rect.width(), height);
+}
+
+QColor RundownItemDelegate::parseColor(const QString& color)
+{
+    // Item colors are style sheet values, either a color name or rgba(r, g, b, a).
+    QRegExp expression("rgba\\((\\d+),\\s*(\\d+),\\s*(\\d+),\\s*(\\d+)\\)");
+    if (expression.exactMatch(color.trimmed()))
+        return QColor(expression.cap(1).toInt(), expression.cap(2).toInt(), expression.cap(3).toInt(), expression.cap(4).toInt());
+
+    return QColor(color);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QModelIndex>
+#include <QtCore/QSize>
+
+#include <QtGui/QPainter>
+
+#include <QtWidgets/QStyledItemDelegate>
+#include <QtWidgets/QStyleOptionViewItem>
+
+class RundownTreeBaseWidget;
+
+/*
+ * Paints the rows of a rundown which have no item widget. Items scrolled
+ * out of view are released to their serialized properties and only keep
+ * their label and color on the tree item, which is all this delegate
+ * draws until the row is scrolled back in and its widget is restored.
+ */
+class WIDGETS_EXPORT RundownItemDelegate : public QStyledItemDelegate
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownItemDelegate(RundownTreeBaseWidget* treeWidget);
+
+        void paint(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const;
+        QSize sizeHint(const QStyleOptionViewItem& option, const QModelIndex& index) const;
+
+    private:
+        RundownTreeBaseWidget* treeWidget;
+
+        static QColor parseColor(const QString& color);
+};
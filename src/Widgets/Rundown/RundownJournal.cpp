@@ -0,0 +1,464 @@
+#include "RundownJournal.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QSaveFile>
+#include <QtCore/QXmlStreamReader>
+#include <QtCore/QXmlStreamWriter>
+
+RundownJournal::RundownJournal(QObject* parent)
+    : QThread(parent),
+      failed(0), stopped(false), allowRemoteTriggering(false)
+{
+}
+
+RundownJournal::~RundownJournal()
+{
+    {
+        QMutexLocker locker(&this->mutex);
+        this->stopped = true;
+        this->condition.wakeAll();
+    }
+
+    // Pending edits and a running compaction are completed first.
+    wait();
+}
+
+QString RundownJournal::getJournalPath(const QString& path)
+{
+    return QString("%1.journal").arg(path);
+}
+
+void RundownJournal::open(const QString& path, const QByteArray& data)
+{
+    this->path = path;
+    this->failed.store(0);
+
+    Entry entry = { EntryType::Open, 0, 0, data, path };
+    enqueue(entry);
+
+    if (!QThread::isRunning())
+        QThread::start(QThread::LowPriority);
+}
+
+void RundownJournal::close()
+{
+    if (this->path.isEmpty())
+        return;
+
+    this->path.clear();
+
+    Entry entry = { EntryType::Close, 0, 0, QByteArray(), QString() };
+    enqueue(entry);
+}
+
+bool RundownJournal::isOpen() const
+{
+    // A failed journal falls back to writing the whole rundown.
+    return !this->path.isEmpty() && this->failed.load() == 0;
+}
+
+const QString& RundownJournal::getPath() const
+{
+    return this->path;
+}
+
+void RundownJournal::insertItem(int row, const QByteArray& item)
+{
+    Entry entry = { EntryType::Insert, row, 0, item, QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::updateItem(int row, const QByteArray& item)
+{
+    Entry entry = { EntryType::Update, row, 0, item, QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::removeItem(int row)
+{
+    Entry entry = { EntryType::Remove, row, 0, QByteArray(), QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::moveItem(int from, int to)
+{
+    Entry entry = { EntryType::Move, from, to, QByteArray(), QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::setAllowRemoteTriggering(bool allowRemoteTriggering)
+{
+    Entry entry = { EntryType::AllowRemoteTriggering, (allowRemoteTriggering == true) ? 1 : 0, 0, QByteArray(), QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::compact()
+{
+    Entry entry = { EntryType::Compact, 0, 0, QByteArray(), QString() };
+    enqueue(entry);
+}
+
+void RundownJournal::enqueue(const Entry& entry)
+{
+    if (this->path.isEmpty() && entry.type != EntryType::Close)
+        return;
+
+    QMutexLocker locker(&this->mutex);
+    this->entries.enqueue(entry);
+    this->condition.wakeAll();
+}
+
+void RundownJournal::run()
+{
+    forever
+    {
+        QQueue<Entry> entries;
+        {
+            QMutexLocker locker(&this->mutex);
+            while (this->entries.isEmpty() && !this->stopped)
+                this->condition.wait(&this->mutex);
+
+            if (this->entries.isEmpty())
+                break;
+
+            entries.swap(this->entries);
+        }
+
+        // Edits queued together are written with a single flush.
+        QByteArray buffer;
+        while (!entries.isEmpty())
+        {
+            Entry entry = entries.dequeue();
+            if (entry.type == EntryType::Open || entry.type == EntryType::Close || entry.type == EntryType::Compact)
+            {
+                if (!buffer.isEmpty() && this->file.isOpen())
+                {
+                    this->file.write(buffer);
+                    this->file.flush();
+                }
+
+                buffer.clear();
+
+                if (entry.type == EntryType::Open)
+                    openJournal(entry.path, entry.data);
+                else if (entry.type == EntryType::Close)
+                    closeJournal();
+                else
+                    compactJournal();
+
+                continue;
+            }
+
+            if (!this->file.isOpen())
+                continue;
+
+            apply(entry, this->items, this->allowRemoteTriggering);
+            buffer.append(encode(entry));
+        }
+
+        if (!buffer.isEmpty() && this->file.isOpen())
+        {
+            // Handed to the operating system, this survives a crash of the client.
+            this->file.write(buffer);
+            this->file.flush();
+        }
+    }
+
+    if (this->file.isOpen())
+        this->file.close();
+}
+
+void RundownJournal::openJournal(const QString& path, const QByteArray& data)
+{
+    closeJournal();
+
+    this->items.clear();
+    this->allowRemoteTriggering = false;
+
+    if (!parse(data, this->items, this->allowRemoteTriggering))
+    {
+        qWarning("Unable to journal rundown %s, the document could not be read", qPrintable(path));
+        this->failed.store(1);
+
+        return;
+    }
+
+    this->documentPath = path;
+    this->file.setFileName(getJournalPath(path));
+
+    // Continue a journal left behind by a crash, its edits were recovered when the rundown was opened.
+    if (this->file.exists() && this->file.open(QIODevice::ReadWrite))
+    {
+        int count = replay(this->file, data, this->items, this->allowRemoteTriggering);
+        if (count >= 0)
+        {
+            // Drop a partially written entry at the end.
+            this->file.resize(this->file.pos());
+
+            qDebug("Continuing rundown journal %s (%d entries)", qPrintable(this->file.fileName()), count);
+
+            return;
+        }
+
+        this->file.close();
+    }
+
+    if (!this->file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        qWarning("Unable to open rundown journal %s", qPrintable(this->file.fileName()));
+        this->failed.store(1);
+
+        return;
+    }
+
+    writeHeader(data);
+}
+
+void RundownJournal::closeJournal()
+{
+    if (this->file.isOpen())
+    {
+        this->file.close();
+
+        // After a failure the journal may hold the only copy of the edits, it's recovered when the rundown is opened.
+        if (this->failed.load() == 0)
+            this->file.remove();
+    }
+
+    this->documentPath.clear();
+    this->items.clear();
+}
+
+void RundownJournal::compactJournal()
+{
+    if (!this->file.isOpen())
+    {
+        emit compacted(false, QString("Unable to open rundown journal %1").arg(this->file.fileName()));
+        return;
+    }
+
+    QByteArray data = serialize(this->items, this->allowRemoteTriggering);
+
+    // The rundown is replaced by an atomic rename, it is never left half written.
+    QSaveFile document(this->documentPath);
+    if (!document.open(QIODevice::WriteOnly) || document.write(data) != data.size() || !document.commit())
+    {
+        this->failed.store(1);
+
+        emit compacted(false, document.errorString());
+        return;
+    }
+
+    // A crash before the new header is written leaves a journal which no longer matches the rundown, it is ignored.
+    this->file.resize(0);
+    this->file.seek(0);
+    writeHeader(data);
+
+    qDebug("Compacted rundown journal into %s (%d items)", qPrintable(this->documentPath), this->items.count());
+
+    emit compacted(true, QString());
+}
+
+bool RundownJournal::writeHeader(const QByteArray& data)
+{
+    QByteArray header = "#journal " + hash(data) + "\n";
+    if (this->file.write(header) != header.size())
+    {
+        qWarning("Unable to write rundown journal %s", qPrintable(this->file.fileName()));
+        this->failed.store(1);
+
+        return false;
+    }
+
+    return this->file.flush();
+}
+
+bool RundownJournal::recover(const QString& path, QByteArray& data)
+{
+    QFile file(getJournalPath(path));
+    if (!file.exists() || !file.open(QIODevice::ReadOnly))
+        return false;
+
+    QList<QByteArray> items;
+    bool allowRemoteTriggering = false;
+    if (!parse(data, items, allowRemoteTriggering))
+        return false;
+
+    int count = replay(file, data, items, allowRemoteTriggering);
+    if (count <= 0)
+        return false;
+
+    qDebug("Recovered %d edits from rundown journal %s", count, qPrintable(file.fileName()));
+
+    data = serialize(items, allowRemoteTriggering);
+
+    return true;
+}
+
+int RundownJournal::replay(QFile& file, const QByteArray& data, QList<QByteArray>& items, bool& allowRemoteTriggering)
+{
+    // The journal only applies to the document it was started from.
+    if (file.readLine().trimmed() != "#journal " + hash(data))
+        return -1;
+
+    int count = 0;
+    while (!file.atEnd())
+    {
+        qint64 position = file.pos();
+
+        QByteArray line = file.readLine();
+        QList<QByteArray> fields = line.trimmed().split(' ');
+        if (!line.endsWith('\n') || fields.count() < 2)
+        {
+            file.seek(position);
+            break;
+        }
+
+        Entry entry = { EntryType::Remove, fields.at(1).toInt(), 0, QByteArray(), QString() };
+        if (fields.at(0) == "insert" || fields.at(0) == "update")
+        {
+            entry.type = (fields.at(0) == "insert") ? EntryType::Insert : EntryType::Update;
+
+            int size = (fields.count() > 2) ? fields.at(2).toInt() : -1;
+            if (size >= 0)
+                entry.data = file.read(size);
+
+            if (size < 0 || entry.data.size() != size || file.read(1) != "\n")
+            {
+                file.seek(position);
+                break;
+            }
+        }
+        else if (fields.at(0) == "move" && fields.count() > 2)
+        {
+            entry.type = EntryType::Move;
+            entry.to = fields.at(2).toInt();
+        }
+        else if (fields.at(0) == "allowremotetriggering")
+        {
+            entry.type = EntryType::AllowRemoteTriggering;
+            entry.row = (fields.at(1) == "true") ? 1 : 0;
+        }
+        else if (fields.at(0) != "remove")
+        {
+            file.seek(position);
+            break;
+        }
+
+        apply(entry, items, allowRemoteTriggering);
+        count++;
+    }
+
+    return count;
+}
+
+void RundownJournal::apply(const Entry& entry, QList<QByteArray>& items, bool& allowRemoteTriggering)
+{
+    switch (entry.type)
+    {
+        case EntryType::Insert:
+            items.insert(qBound(0, entry.row, items.count()), entry.data);
+            break;
+        case EntryType::Update:
+            if (entry.row >= 0 && entry.row < items.count())
+                items[entry.row] = entry.data;
+            break;
+        case EntryType::Remove:
+            if (entry.row >= 0 && entry.row < items.count())
+                items.removeAt(entry.row);
+            break;
+        case EntryType::Move:
+            if (entry.row >= 0 && entry.row < items.count() && entry.to >= 0 && entry.to < items.count())
+                items.move(entry.row, entry.to);
+            break;
+        case EntryType::AllowRemoteTriggering:
+            allowRemoteTriggering = (entry.row == 1);
+            break;
+        default:
+            break;
+    }
+}
+
+QByteArray RundownJournal::encode(const Entry& entry)
+{
+    switch (entry.type)
+    {
+        case EntryType::Insert:
+            return "insert " + QByteArray::number(entry.row) + " " + QByteArray::number(entry.data.size()) + "\n" + entry.data + "\n";
+        case EntryType::Update:
+            return "update " + QByteArray::number(entry.row) + " " + QByteArray::number(entry.data.size()) + "\n" + entry.data + "\n";
+        case EntryType::Remove:
+            return "remove " + QByteArray::number(entry.row) + "\n";
+        case EntryType::Move:
+            return "move " + QByteArray::number(entry.row) + " " + QByteArray::number(entry.to) + "\n";
+        case EntryType::AllowRemoteTriggering:
+            return QByteArray("allowremotetriggering ") + ((entry.row == 1) ? "true" : "false") + "\n";
+        default:
+            return QByteArray();
+    }
+}
+
+QByteArray RundownJournal::serialize(const QList<QByteArray>& items, bool allowRemoteTriggering)
+{
+    // Same document as written by a full save.
+    QByteArray data = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><items><allowremotetriggering>";
+    data.append((allowRemoteTriggering == true) ? "true" : "false");
+    data.append("</allowremotetriggering>");
+
+    foreach (const QByteArray& item, items)
+        data.append(item);
+
+    data.append("</items>\n");
+
+    return data;
+}
+
+QByteArray RundownJournal::hash(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex();
+}
+
+bool RundownJournal::parse(const QByteArray& data, QList<QByteArray>& items, bool& allowRemoteTriggering)
+{
+    QXmlStreamReader reader(data);
+    if (!reader.readNextStartElement() || reader.name() != "items")
+        return false;
+
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() == "allowremotetriggering")
+        {
+            allowRemoteTriggering = (reader.readElementText() == "true");
+
+            continue;
+        }
+        else if (reader.name() != "item")
+        {
+            reader.skipCurrentElement();
+
+            continue;
+        }
+
+        // Each top-level item is kept as its own fragment so edits only touch the item they change.
+        QByteArray item;
+        QXmlStreamWriter writer(&item);
+        writer.writeCurrentToken(reader);
+
+        int depth = 1;
+        while (depth > 0 && !reader.atEnd())
+        {
+            reader.readNext();
+            if (reader.isStartElement())
+                depth++;
+            else if (reader.isEndElement())
+                depth--;
+
+            writer.writeCurrentToken(reader);
+        }
+
+        items.append(item);
+    }
+
+    return !reader.hasError();
+}
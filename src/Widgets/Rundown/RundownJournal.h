@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QQueue>
+#include <QtCore/QString>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+
+/*
+ * Append-only journal of the edits made to a rundown since it was last
+ * written. Every edit is appended to <rundown>.journal on a worker thread
+ * instead of rewriting the whole document, and saving compacts the journal
+ * into the rundown in the background. The journal is left behind if the
+ * client crashes and its edits are recovered when the rundown is opened.
+ * The outcome of every compaction is reported back with compacted().
+ */
+class WIDGETS_EXPORT RundownJournal : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownJournal(QObject* parent = 0);
+        ~RundownJournal();
+
+        void open(const QString& path, const QByteArray& data);
+        void close();
+        bool isOpen() const;
+        const QString& getPath() const;
+
+        void insertItem(int row, const QByteArray& item);
+        void updateItem(int row, const QByteArray& item);
+        void removeItem(int row);
+        void moveItem(int from, int to);
+        void setAllowRemoteTriggering(bool allowRemoteTriggering);
+
+        void compact();
+
+        static QString getJournalPath(const QString& path);
+        static bool recover(const QString& path, QByteArray& data);
+
+        Q_SIGNAL void compacted(bool, const QString&);
+
+    protected:
+        void run();
+
+    private:
+        enum class EntryType
+        {
+            Open,
+            Close,
+            Compact,
+            Insert,
+            Update,
+            Remove,
+            Move,
+            AllowRemoteTriggering
+        };
+
+        struct Entry
+        {
+            EntryType type;
+            int row;
+            int to;
+            QByteArray data;
+            QString path;
+        };
+
+        QString path;
+        QAtomicInt failed;
+
+        QMutex mutex;
+        QWaitCondition condition;
+        QQueue<Entry> entries;
+        bool stopped;
+
+        // Owned by the worker thread.
+        QFile file;
+        QString documentPath;
+        QList<QByteArray> items;
+        bool allowRemoteTriggering;
+
+        void enqueue(const Entry& entry);
+
+        void openJournal(const QString& path, const QByteArray& data);
+        void closeJournal();
+        void compactJournal();
+        bool writeHeader(const QByteArray& data);
+
+        static QByteArray encode(const Entry& entry);
+        static QByteArray serialize(const QList<QByteArray>& items, bool allowRemoteTriggering);
+        static QByteArray hash(const QByteArray& data);
+        static bool parse(const QByteArray& data, QList<QByteArray>& items, bool& allowRemoteTriggering);
+        static int replay(QFile& file, const QByteArray& data, QList<QByteArray>& items, bool& allowRemoteTriggering);
+        static void apply(const Entry& entry, QList<QByteArray>& items, bool& allowRemoteTriggering);
+};
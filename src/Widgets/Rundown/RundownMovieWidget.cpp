@@ -3,11 +3,12 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
+#include "StageStateManager.h"
 #include "EventManager.h"
 #include "Events/ConnectionStateChangedEvent.h"
-#include "Events/Rundown/AutoPlayRundownItemEvent.h"
 
 #include <math.h>
 
@@ -22,8 +23,7 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
                                        bool loaded, bool paused, bool playing, bool inGroup, bool compactView)
     : QWidget(parent),
       active(active), loaded(loaded), paused(paused), playing(playing), inGroup(inGroup), compactView(compactView), color(color), model(model),
-      reverseOscTime(false), sendAutoPlay(false), hasSentAutoPlay(false), useFreezeOnLoad(false), fileModel(NULL), timeSubscription(NULL),
-      frameSubscription(NULL), fpsSubscription(NULL), pathSubscription(NULL), pausedSubscription(NULL), loopSubscription(NULL), stopControlSubscription(NULL),
+      reverseOscTime(false), useFreezeOnLoad(false), stageSubscription(NULL), stopControlSubscription(NULL),
       playControlSubscription(NULL), playNowControlSubscription(NULL), loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL),
       updateControlSubscription(NULL), previewControlSubscription(NULL), clearControlSubscription(NULL), clearVideolayerControlSubscription(NULL), clearChannelControlSubscription(NULL)
 {
@@ -35,7 +35,6 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
     this->markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
     this->useFreezeOnLoad = (DatabaseManager::getInstance().getConfigurationByName("UseFreezeOnLoad").getValue() == "true") ? true : false;
 
-    setThumbnail();
     setColor(this->color);
     setActive(this->active);
     setCompactView(this->compactView);
@@ -66,6 +65,7 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(loopChanged(bool)), this, SLOT(loopChanged(bool)));
     QObject::connect(&this->command, SIGNAL(autoPlayChanged(bool)), this, SLOT(autoPlayChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(changed()), this, SLOT(commandChanged()));
     QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
@@ -75,7 +75,10 @@ RundownMovieWidget::RundownMovieWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(device.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -146,7 +149,13 @@ void RundownMovieWidget::deviceChanged(const DeviceChangedEvent& event)
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<CasparDevice> oldDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
+
+        // The clip loaded on the old device can't be played on the new one.
+        releasePreroll();
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -155,7 +164,10 @@ void RundownMovieWidget::deviceChanged(const DeviceChangedEvent& event)
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<CasparDevice> newDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
     }
 
     checkEmptyDevice();
@@ -251,6 +263,8 @@ LibraryModel* RundownMovieWidget::getLibraryModel()
 
 void RundownMovieWidget::setThumbnail()
 {
+    this->thumbnailLoaded = true;
+
     if (this->model.getType() == "AUDIO")
     {
         this->labelThumbnail->setVisible(false);
@@ -279,6 +293,22 @@ void RundownMovieWidget::setSelected(bool selected)
     this->selected = selected;
 }
 
+bool RundownMovieWidget::isLive() const
+{
+    return this->loaded || this->paused || this->playing;
+}
+
+void RundownMovieWidget::setInViewport(bool inViewport)
+{
+    this->inViewport = inViewport;
+
+    // Thumbnails are decoded the first time the item is scrolled into view.
+    if (this->inViewport && !this->thumbnailLoaded)
+        setThumbnail();
+
+    updateStageSubscription();
+}
+
 void RundownMovieWidget::setActive(bool active)
 {
     this->active = active;
@@ -340,6 +370,8 @@ void RundownMovieWidget::clearDelayedCommands()
 
 void RundownMovieWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL || this->labelThumbnail->graphicsEffect() == NULL || this->widgetOscTime->graphicsEffect() == NULL)
@@ -366,6 +398,11 @@ void RundownMovieWidget::setUsed(bool used)
     }
 }
 
+bool RundownMovieWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownMovieWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -396,14 +433,11 @@ bool RundownMovieWidget::executeCommand(Playout::PlayoutType type)
 
                     double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                    int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                    this->executeStartTimer.setInterval(startDelay);
+                    QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                    this->executeStartTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                     if (this->command.getDuration() > 0)
-                    {
-                        int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                        this->executeStopTimer.setInterval(startDelay + stopDelay);
-                    }
+                        this->executeStopTimer.setFrameInterval(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock);
                 }
                 else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
                 {
@@ -444,6 +478,8 @@ bool RundownMovieWidget::executeCommand(Playout::PlayoutType type)
     if (this->active)
         this->animation->start(1);
 
+    updateStageSubscription();
+
     return true;
 }
 
@@ -452,10 +488,12 @@ void RundownMovieWidget::executeStop()
     this->executeStartTimer.stop();
     this->executeStopTimer.stop();
 
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Stop);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
     {
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
+        device->writeEncodedMessage(message);
 
         // Stop preview channels item.
         const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
@@ -471,7 +509,7 @@ void RundownMovieWidget::executeStop()
         const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
         if (deviceShadow != NULL && deviceShadow->isConnected())
         {
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
+            deviceShadow->writeEncodedMessage(message);
 
             // Stop preview channels item.
             if (model.getPreviewChannel() > 0)
@@ -482,72 +520,24 @@ void RundownMovieWidget::executeStop()
     this->paused = false;
     this->loaded = false;
     this->playing = false;
-    this->sendAutoPlay= false;
 
     this->widgetOscTime->setPaused(this->paused);
     this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
 }
 
 void RundownMovieWidget::executePlay()
 {
+    // The message is compiled when the item is edited, a take only writes it.
+    const QByteArray& message = this->command.getAmcpMessage((this->loaded == true) ? AbstractCommand::AmcpMessage::PlayLoaded : AbstractCommand::AmcpMessage::Play);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-        {
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        }
-        else
-        {
-            if (this->command.getAutoPlay())
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), true);
-            }
-            else
-            {
-                device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                  this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                  this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                  this->command.getLoop(), this->command.getAutoPlay());
-            }
-        }
-    }
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-            {
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            }
-            else
-            {
-                if (this->command.getAutoPlay())
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), true);
-                }
-                else
-                {
-                    deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                            this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                            this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                            this->command.getLoop(), this->command.getAutoPlay());
-                }
-            }
-        }
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     if (this->markUsedItems)
@@ -556,10 +546,8 @@ void RundownMovieWidget::executePlay()
     this->paused = false;
     this->loaded = false;
     this->playing = true;
-    this->hasSentAutoPlay = false;
 
-    if (this->command.getAutoPlay())
-        this->sendAutoPlay= true;
+    updateStageSubscription();
 }
 
 void RundownMovieWidget::executePause()
@@ -598,34 +586,23 @@ void RundownMovieWidget::executePause()
 
 void RundownMovieWidget::executeLoad()
 {
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Load);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-    {
-        device->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                          this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-    }
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            deviceShadow->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                    this->command.getLoop(), this->command.getFreezeOnLoad(), false);
-        }
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     this->loaded = true;
     this->paused = false;
     this->playing = false;
-    this->sendAutoPlay= false;
+
+    updateStageSubscription();
 }
 
 void RundownMovieWidget::executeLoadPreview()
@@ -666,38 +643,68 @@ void RundownMovieWidget::executeNext()
 {
     if (this->command.getAutoPlay())
     {
+        const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Next);
+
         const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (device != NULL && device->isConnected())
-        {
-            device->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                              this->command.getLoop(), false);
+            device->writeEncodedMessage(message);
 
-        }
-
-        foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+        foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
         {
-            if (model.getShadow() == "No")
-                continue;
-
-            const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-            if (deviceShadow != NULL && deviceShadow->isConnected())
-            {
-                deviceShadow->playMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
-                                        this->command.getLoop(), false);
-            }
+            if (deviceShadow->isConnected())
+                deviceShadow->writeEncodedMessage(message);
         }
 
         this->paused = false;
         this->loaded = false;
         this->playing = true;
 
-        if (this->command.getAutoPlay())
-            this->sendAutoPlay= true;
+        updateStageSubscription();
+    }
+}
+
+bool RundownMovieWidget::executePreroll()
+{
+    // Only an idle item is loaded ahead, AutoPlay items chain their own background loads.
+    if (this->playing || this->command.getAutoPlay())
+        return false;
+
+    if (this->loaded)
+        return true;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device == NULL || !device->isConnected())
+        return false;
+
+    // Always into the background, what is on air is left untouched until the item is played.
+    device->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                      this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                      this->command.getLoop(), false, false);
+
+    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    {
+        if (model.getShadow() == "No")
+            continue;
+
+        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
+        if (deviceShadow != NULL && deviceShadow->isConnected())
+            deviceShadow->loadMovie(this->command.getChannel(), this->command.getVideolayer(), this->command.getVideoName(),
+                                    this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                                    this->command.getDirection(), this->command.getSeek(), this->command.getLength(),
+                                    this->command.getLoop(), false, false);
     }
+
+    // The next play takes the loaded clip instead of opening it again.
+    this->loaded = true;
+
+    return true;
+}
+
+void RundownMovieWidget::releasePreroll()
+{
+    if (!this->playing)
+        this->loaded = false;
 }
 
 void RundownMovieWidget::executeClearVideolayer()
@@ -735,12 +742,9 @@ void RundownMovieWidget::executeClearVideolayer()
     this->paused = false;
     this->loaded = false;
     this->playing = false;
-    this->sendAutoPlay= false;
 
     this->widgetOscTime->setPaused(this->paused);
     this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
 }
 
 void RundownMovieWidget::executeClearChannel()
@@ -786,12 +790,9 @@ void RundownMovieWidget::executeClearChannel()
     this->paused = false;
     this->loaded = false;
     this->playing = false;
-    this->sendAutoPlay= false;
 
     this->widgetOscTime->setPaused(this->paused);
     this->widgetOscTime->reset();
-
-    this->hasSentAutoPlay = false;
 }
 
 void RundownMovieWidget::checkGpiConnection()
@@ -821,71 +822,9 @@ void RundownMovieWidget::configureOscSubscriptions()
     if (DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName()) == NULL)
             return;
 
-    if (this->timeSubscription != NULL)
-        this->timeSubscription->disconnect(); // Disconnect all events.
-
-    if (this->frameSubscription != NULL)
-        this->frameSubscription->disconnect(); // Disconnect all events.
-
-    if (this->fpsSubscription != NULL)
-        this->fpsSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pathSubscription != NULL)
-        this->pathSubscription->disconnect(); // Disconnect all events.
-
-    if (this->pausedSubscription != NULL)
-        this->pausedSubscription->disconnect(); // Disconnect all events.
-
-    if (this->loopSubscription != NULL)
-        this->loopSubscription->disconnect(); // Disconnect all events.
-
-    QString timeFilter = Osc::DEFAULT_TIME_FILTER;
-    timeFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->timeSubscription = new OscSubscription(timeFilter, this);
-    QObject::connect(this->timeSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(timeSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString frameFilter = Osc::DEFAULT_FRAME_FILTER;
-    frameFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-               .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-               .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->frameSubscription = new OscSubscription(frameFilter, this);
-    QObject::connect(this->frameSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(frameSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString fpsFilter = Osc::DEFAULT_FPS_FILTER;
-    fpsFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-             .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-             .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->fpsSubscription = new OscSubscription(fpsFilter, this);
-    QObject::connect(this->fpsSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(fpsSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pathFilter = Osc::DEFAULT_PATH_FILTER;
-    pathFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pathSubscription = new OscSubscription(pathFilter, this);
-    QObject::connect(this->pathSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pathSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString pausedFilter = Osc::DEFAULT_PAUSED_FILTER;
-    pausedFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-                .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-                .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->pausedSubscription = new OscSubscription(pausedFilter, this);
-    QObject::connect(this->pausedSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(pausedSubscriptionReceived(const QString&, const QList<QVariant>&)));
-
-    QString loopFilter = Osc::DEFAULT_LOOP_FILTER;
-    loopFilter.replace("#IPADDRESS#", QString("%1").arg(DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName())->resolveIpAddress()))
-              .replace("#CHANNEL#", QString("%1").arg(this->command.getChannel()))
-              .replace("#VIDEOLAYER#", QString("%1").arg(this->command.getVideolayer()));
-    this->loopSubscription = new OscSubscription(loopFilter, this);
-    QObject::connect(this->loopSubscription, SIGNAL(subscriptionReceived(const QString&, const QList<QVariant>&)),
-                     this, SLOT(loopSubscriptionReceived(const QString&, const QList<QVariant>&)));
+    // Channel or video layer might have changed, subscribe to the new layer.
+    releaseStageSubscription();
+    updateStageSubscription();
 
     if (!this->command.getAllowRemoteTriggering())
         return;
@@ -990,6 +929,41 @@ void RundownMovieWidget::configureOscSubscriptions()
                      this, SLOT(clearChannelControlSubscriptionReceived(const QString&, const QList<QVariant>&)));
 }
 
+void RundownMovieWidget::updateStageSubscription()
+{
+    // Playout state is only of interest on screen or while we own the layer.
+    bool required = this->inViewport || this->loaded || this->paused || this->playing;
+    if (!required)
+    {
+        releaseStageSubscription();
+        return;
+    }
+
+    if (this->stageSubscription != NULL)
+        return;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device == NULL)
+        return;
+
+    QString stageKey = StageStateManager::getLayerKey(device->resolveIpAddress(), this->command.getChannel(), this->command.getVideolayer());
+    this->stageSubscription = new StageStateSubscription(stageKey, this);
+    QObject::connect(this->stageSubscription, SIGNAL(layerChanged(const OscLayerModel&)), this, SLOT(stageStateChanged(const OscLayerModel&)));
+}
+
+void RundownMovieWidget::releaseStageSubscription()
+{
+    if (this->stageSubscription == NULL)
+        return;
+
+    this->stageSubscription->disconnect(); // Disconnect all events.
+    this->stageSubscription->deleteLater();
+    this->stageSubscription = NULL;
+
+    // No further updates will arrive, don't leave a stale time behind.
+    this->widgetOscTime->reset();
+}
+
 void RundownMovieWidget::channelChanged(int channel)
 {
     this->labelChannel->setText(QString("Channel: %1").arg(channel));
@@ -1036,114 +1010,73 @@ void RundownMovieWidget::remoteTriggerIdChanged(const QString& remoteTriggerId)
     this->labelRemoteTriggerId->setText(QString("UID: %1").arg(remoteTriggerId));
 }
 
+void RundownMovieWidget::commandChanged()
+{
+    // The loaded clip no longer matches the item, it's loaded again as edited.
+    releasePreroll();
+}
+
 void RundownMovieWidget::deviceConnectionStateChanged(CasparDevice& device)
 {
     Q_UNUSED(device);
 
+    // The background is gone with the connection, or with the server if it was restarted.
+    releasePreroll();
+
     checkDeviceConnection();
 }
 
-void RundownMovieWidget::deviceAdded(CasparDevice& device)
+void RundownMovieWidget::deviceLayerCleared(int channel, int videolayer, CasparDevice& device)
 {
-    if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress())->getName() == this->model.getDeviceName())
-        QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+    Q_UNUSED(device);
 
-    checkDeviceConnection();
-    configureOscSubscriptions();
+    // Cleared by any item, the loaded clip is opened again when played.
+    if (channel == this->command.getChannel() && (videolayer == -1 || videolayer == this->command.getVideolayer()))
+        releasePreroll();
 }
 
-void RundownMovieWidget::timeSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownMovieWidget::deviceAdded(CasparDevice& device)
 {
-    Q_UNUSED(predicate);
-
-    if (this->fileModel != NULL)
+    if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress())->getName() == this->model.getDeviceName())
     {
-        delete this->fileModel;
-        this->fileModel = NULL;
+        QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(&device, SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
     }
 
-    this->fileModel = new OscFileModel();
-    this->fileModel->setTime(arguments.at(0).toDouble());
-    this->fileModel->setTotalTime(arguments.at(1).toDouble());
-}
-
-void RundownMovieWidget::frameSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setFrame(arguments.at(0).toInt());
-    this->fileModel->setTotalFrames(arguments.at(1).toInt());
+    checkDeviceConnection();
+    configureOscSubscriptions();
 }
 
-void RundownMovieWidget::fpsSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
+void RundownMovieWidget::stageStateChanged(const OscLayerModel& layer)
 {
-    Q_UNUSED(predicate);
+    if (!layer.isActive())
+    {
+        this->widgetOscTime->reset();
 
-    if (this->fileModel == NULL)
         return;
+    }
 
-    this->fileModel->setFramesPerSecond(arguments.at(0).toDouble());
-}
-
-void RundownMovieWidget::pathSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
+    this->widgetOscTime->setPaused(layer.getPaused());
+    this->widgetOscTime->setLoop(layer.getLoop());
 
-    QString name = arguments.at(0).toString();
+    QString name = layer.getPath();
     name.remove(name.lastIndexOf('.'), name.length()); // Remove extension.
 
     if (this->model.getName().toLower() != name.toLower())
         return; // Wrong file.
 
-    if (this->fileModel == NULL)
-        return;
-
-    this->fileModel->setPath(arguments.at(0).toString());
-
-    this->widgetOscTime->setProgress(this->fileModel->getFrame());
-
-    if (this->reverseOscTime && this->fileModel->getFrame() > 0)
-        this->widgetOscTime->setTime(this->fileModel->getTotalFrames() - this->fileModel->getFrame());
-    else
-        this->widgetOscTime->setTime(this->fileModel->getFrame());
+    this->widgetOscTime->setFramesPerSecond(layer.getFramesPerSecond());
 
     if (this->command.getSeek() == 0 && this->command.getLength() == 0)
-        this->widgetOscTime->setInOutTime(0, this->fileModel->getTotalFrames());
+        this->widgetOscTime->setInOutTime(0, layer.getTotalFrames());
     else
         this->widgetOscTime->setInOutTime(this->command.getSeek(), this->command.getLength());
 
-    this->widgetOscTime->setFramesPerSecond(this->fileModel->getFramesPerSecond());
-
-    if (this->sendAutoPlay && !this->hasSentAutoPlay)
-    {
-        EventManager::getInstance().fireAutoPlayRundownItemEvent(AutoPlayRundownItemEvent(this));
-
-        this->sendAutoPlay = false;
-        this->hasSentAutoPlay = true;
-
-        qDebug("Dispatched AutoPlay event");
-    }
+    this->widgetOscTime->setPosition(layer.getFrame(), layer.getTotalFrames());
 
     this->playing = true;
 }
 
-void RundownMovieWidget::pausedSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setPaused(arguments.at(0).toBool());
-}
-
-void RundownMovieWidget::loopSubscriptionReceived(const QString& predicate, const QList<QVariant>& arguments)
-{
-    Q_UNUSED(predicate);
-
-    this->widgetOscTime->setLoop(arguments.at(0).toBool());
-}
-
 void RundownMovieWidget::autoPlayChanged(bool autoPlay)
 {
     this->labelAutoPlay->setVisible(autoPlay);
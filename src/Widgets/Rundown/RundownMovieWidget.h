@@ -11,6 +11,8 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
+#include "StageStateSubscription.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -21,7 +23,7 @@
 #include "Events/Inspector/TargetChangedEvent.h"
 #include "Events/Inspector/VideolayerChangedEvent.h"
 #include "Models/LibraryModel.h"
-#include "Models/OscFileModel.h"
+#include "Models/OscLayerModel.h"
 
 #include <QtCore/QString>
 #include <QtCore/QTimer>
@@ -57,7 +59,12 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
+        virtual void setInViewport(bool inViewport);
+        virtual bool executePreroll();
+        virtual void releasePreroll();
+        virtual bool isLive() const;
 
     private:
         bool active;
@@ -71,20 +78,15 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         MovieCommand command;
         ActiveAnimation* animation;
         bool reverseOscTime;
-        bool sendAutoPlay;
-        bool hasSentAutoPlay;
         QString delayType;
         bool markUsedItems;
         bool useFreezeOnLoad;
         bool selected = false;
+        bool used = false;
+        bool inViewport = false;
+        bool thumbnailLoaded = false;
 
-        OscFileModel* fileModel;
-        OscSubscription* timeSubscription;
-        OscSubscription* frameSubscription;
-        OscSubscription* fpsSubscription;
-        OscSubscription* pathSubscription;
-        OscSubscription* pausedSubscription;
-        OscSubscription* loopSubscription;
+        StageStateSubscription* stageSubscription;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -98,14 +100,16 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeStartTimer;
-        QTimer executeStopTimer;
+        ScheduledTimer executeStartTimer;
+        ScheduledTimer executeStopTimer;
 
         void setThumbnail();
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
         void configureOscSubscriptions();
+        void updateStageSubscription();
+        void releaseStageSubscription();
         void setTimecode(const QString& timecode);
 
         Q_SLOT void channelChanged(int);
@@ -123,14 +127,11 @@ class WIDGETS_EXPORT RundownMovieWidget : public QWidget, Ui::RundownMovieWidget
         Q_SLOT void loopChanged(bool);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void remoteTriggerIdChanged(const QString&);
+        Q_SLOT void commandChanged();
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void deviceLayerCleared(int, int, CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
-        Q_SLOT void timeSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void frameSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void fpsSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pathSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void pausedSubscriptionReceived(const QString&, const QList<QVariant>&);
-        Q_SLOT void loopSubscriptionReceived(const QString&, const QList<QVariant>&);
+        Q_SLOT void stageStateChanged(const OscLayerModel&);
         Q_SLOT void autoPlayChanged(bool);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
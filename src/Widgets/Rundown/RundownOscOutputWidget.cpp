@@ -177,6 +177,8 @@ void RundownOscOutputWidget::clearDelayedCommands()
 
 void RundownOscOutputWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -191,6 +193,11 @@ void RundownOscOutputWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownOscOutputWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownOscOutputWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
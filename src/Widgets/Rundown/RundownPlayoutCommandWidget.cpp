@@ -168,6 +168,8 @@ void RundownPlayoutCommandWidget::clearDelayedCommands()
 
 void RundownPlayoutCommandWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -182,6 +184,11 @@ void RundownPlayoutCommandWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownPlayoutCommandWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownPlayoutCommandWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Play)
@@ -9,6 +9,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -49,6 +50,7 @@ class WIDGETS_EXPORT RundownPlayoutCommandWidget : public QWidget, Ui::RundownPl
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     private:
@@ -62,11 +64,12 @@ class WIDGETS_EXPORT RundownPlayoutCommandWidget : public QWidget, Ui::RundownPl
         QString delayType;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* playControlSubscription;
         OscSubscription* playNowControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
 
         void checkGpiConnection();
         void configureOscSubscriptions();
@@ -0,0 +1,116 @@
+#include "RundownReader.h"
+
+#include <QtCore/QMutexLocker>
+
+RundownReader::RundownReader(const QByteArray& data, QObject* parent)
+    : QThread(parent),
+      data(data), cancelled(0), progress(0), notified(false)
+{
+}
+
+void RundownReader::cancel()
+{
+    this->cancelled.store(1);
+}
+
+bool RundownReader::isCancelled() const
+{
+    return this->cancelled.load() == 1;
+}
+
+int RundownReader::getProgress() const
+{
+    return this->progress.load();
+}
+
+QList<boost::property_tree::wptree> RundownReader::takeItems(int count)
+{
+    QMutexLocker locker(&this->mutex);
+
+    QList<boost::property_tree::wptree> items = this->items.mid(0, count);
+    this->items.erase(this->items.begin(), this->items.begin() + items.count());
+
+    // The consumer has caught up, wake it up again on the next item.
+    if (this->items.isEmpty())
+        this->notified = false;
+
+    return items;
+}
+
+void RundownReader::run()
+{
+    QXmlStreamReader reader(this->data);
+    if (!reader.readNextStartElement() || reader.name() != "items")
+    {
+        qWarning("Unable to read rundown: %s", qPrintable(reader.hasError() ? reader.errorString() : "missing items element"));
+        return;
+    }
+
+    while (!isCancelled() && reader.readNextStartElement())
+    {
+        if (reader.name() == "allowremotetriggering")
+        {
+            emit allowRemoteTriggeringRead(reader.readElementText() == "true");
+
+            continue;
+        }
+        else if (reader.name() != "item")
+        {
+            reader.skipCurrentElement();
+
+            continue;
+        }
+
+        boost::property_tree::wptree pt;
+        readElement(reader, pt);
+
+        this->progress.store(static_cast<int>(reader.characterOffset() * 100 / qMax(1, this->data.size())));
+
+        bool notify = false;
+        {
+            QMutexLocker locker(&this->mutex);
+            this->items.append(pt);
+
+            // Only signal once per batch, the consumer drains the queue.
+            notify = !this->notified;
+            this->notified = true;
+        }
+
+        if (notify)
+            emit itemsAvailable();
+    }
+
+    if (reader.hasError())
+        qWarning("Error while reading rundown at line %lld: %s", reader.lineNumber(), qPrintable(reader.errorString()));
+
+    this->progress.store(100);
+}
+
+void RundownReader::readElement(QXmlStreamReader& reader, boost::property_tree::wptree& pt)
+{
+    foreach (const QXmlStreamAttribute& attribute, reader.attributes())
+        pt.put(L"<xmlattr>." + attribute.name().toString().toStdWString(), attribute.value().toString().toStdWString());
+
+    QString text;
+    bool leaf = true;
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+
+        if (reader.isStartElement())
+        {
+            leaf = false;
+
+            boost::property_tree::wptree& child = pt.push_back(std::make_pair(reader.name().toString().toStdWString(), boost::property_tree::wptree()))->second;
+            readElement(reader, child);
+        }
+        else if (reader.isCharacters())
+            text += reader.text();
+        else if (reader.isEndElement())
+            break;
+    }
+
+    // Indentation between child elements is of no interest.
+    if (leaf)
+        pt.data() = text.toStdWString();
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../Shared.h"
+
+#include <boost/property_tree/ptree.hpp>
+
+#include <QtCore/QAtomicInt>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QThread>
+#include <QtCore/QXmlStreamReader>
+
+/*
+ * Parses a rundown document on a worker thread. Each top-level item is
+ * turned into a property tree and queued in document order, ready for
+ * the GUI thread to construct its widget.
+ */
+class WIDGETS_EXPORT RundownReader : public QThread
+{
+    Q_OBJECT
+
+    public:
+        explicit RundownReader(const QByteArray& data, QObject* parent = 0);
+
+        void cancel();
+        bool isCancelled() const;
+
+        int getProgress() const;
+        QList<boost::property_tree::wptree> takeItems(int count);
+
+        static void readElement(QXmlStreamReader& reader, boost::property_tree::wptree& pt);
+
+        Q_SIGNAL void itemsAvailable();
+        Q_SIGNAL void allowRemoteTriggeringRead(bool);
+
+    protected:
+        void run();
+
+    private:
+        QByteArray data;
+        QAtomicInt cancelled;
+        QAtomicInt progress;
+
+        QMutex mutex;
+        QList<boost::property_tree::wptree> items;
+        bool notified;
+};
@@ -3,6 +3,7 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
@@ -31,7 +32,6 @@ RundownStillWidget::RundownStillWidget(const LibraryModel& model, QWidget* paren
     this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
     this->markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
 
-    setThumbnail();
     setColor(this->color);
     setActive(this->active);
     setCompactView(this->compactView);
@@ -56,6 +56,7 @@ RundownStillWidget::RundownStillWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
     QObject::connect(&this->command, SIGNAL(allowGpiChanged(bool)), this, SLOT(allowGpiChanged(bool)));
     QObject::connect(&this->command, SIGNAL(remoteTriggerIdChanged(const QString&)), this, SLOT(remoteTriggerIdChanged(const QString&)));
+    QObject::connect(&this->command, SIGNAL(changed()), this, SLOT(commandChanged()));
     QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(deviceChanged(const DeviceChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(targetChanged(const TargetChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(labelChanged(const LabelChangedEvent&)));
@@ -63,7 +64,10 @@ RundownStillWidget::RundownStillWidget(const LibraryModel& model, QWidget* paren
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(device.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -106,7 +110,13 @@ void RundownStillWidget::deviceChanged(const DeviceChangedEvent& event)
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<CasparDevice> oldDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
+
+        // The image loaded on the old device can't be played on the new one.
+        releasePreroll();
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -115,7 +125,10 @@ void RundownStillWidget::deviceChanged(const DeviceChangedEvent& event)
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<CasparDevice> newDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
     }
 
     checkEmptyDevice();
@@ -199,6 +212,8 @@ LibraryModel* RundownStillWidget::getLibraryModel()
 
 void RundownStillWidget::setThumbnail()
 {
+    this->thumbnailLoaded = true;
+
     QString data = DatabaseManager::getInstance().getThumbnailByNameAndDeviceName(this->model.getName(), this->model.getDeviceName()).getData();
 
     /*
@@ -221,6 +236,15 @@ void RundownStillWidget::setSelected(bool selected)
     this->selected = selected;
 }
 
+void RundownStillWidget::setInViewport(bool inViewport)
+{
+    this->inViewport = inViewport;
+
+    // Thumbnails are decoded the first time the item is scrolled into view.
+    if (this->inViewport && !this->thumbnailLoaded)
+        setThumbnail();
+}
+
 void RundownStillWidget::setActive(bool active)
 {
     this->active = active;
@@ -269,6 +293,8 @@ void RundownStillWidget::clearDelayedCommands()
 
 void RundownStillWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL || this->labelThumbnail->graphicsEffect() == NULL)
@@ -290,6 +316,11 @@ void RundownStillWidget::setUsed(bool used)
     }
 }
 
+bool RundownStillWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownStillWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -309,21 +340,18 @@ bool RundownStillWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStop()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executeTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
             }
 
             this->executeTimer.start();
@@ -356,10 +384,12 @@ void RundownStillWidget::executeStop()
 {
     this->executeTimer.stop();
 
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Stop);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
     {
-        device->stop(this->command.getChannel(), this->command.getVideolayer());
+        device->writeEncodedMessage(message);
 
         // Stop preview channels item.
         const QSharedPointer<DeviceModel> deviceModel = DeviceManager::getInstance().getDeviceModelByName(this->model.getDeviceName());
@@ -375,7 +405,7 @@ void RundownStillWidget::executeStop()
         const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
         if (deviceShadow != NULL && deviceShadow->isConnected())
         {
-            deviceShadow->stop(this->command.getChannel(), this->command.getVideolayer());
+            deviceShadow->writeEncodedMessage(message);
 
             // Stop preview channels item.
             if (model.getPreviewChannel() > 0)
@@ -390,32 +420,16 @@ void RundownStillWidget::executeStop()
 
 void RundownStillWidget::executePlay()
 {
+    const QByteArray& message = this->command.getAmcpMessage((this->loaded == true) ? AbstractCommand::AmcpMessage::PlayLoaded : AbstractCommand::AmcpMessage::Play);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
-    {
-        if (this->loaded)
-            device->play(this->command.getChannel(), this->command.getVideolayer());
-        else
-            device->playStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                              this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                              this->command.getDirection(), this->command.getUseAuto());
-    }
+        device->writeEncodedMessage(message);
 
-    foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        if (model.getShadow() == "No")
-            continue;
-
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
-        if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
-            if (this->loaded)
-                deviceShadow->play(this->command.getChannel(), this->command.getVideolayer());
-            else
-                deviceShadow->playStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                                        this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                        this->command.getDirection(), this->command.getUseAuto());
-        }
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
     if (this->markUsedItems)
@@ -492,31 +506,63 @@ void RundownStillWidget::executePause()
 
 void RundownStillWidget::executeLoad()
 {
+    const QByteArray& message = this->command.getAmcpMessage(AbstractCommand::AmcpMessage::Load);
+
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL && device->isConnected())
+        device->writeEncodedMessage(message);
+
+    foreach (const QSharedPointer<CasparDevice>& deviceShadow, DeviceManager::getInstance().getShadowDevices())
     {
-        device->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
-                          this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                          this->command.getDirection(), this->command.getUseAuto());
+        if (deviceShadow->isConnected())
+            deviceShadow->writeEncodedMessage(message);
     }
 
+    this->loaded = true;
+    this->paused = false;
+    this->playing = false;
+}
+
+bool RundownStillWidget::executePreroll()
+{
+    // Only an idle item is loaded ahead, items using AUTO wait for the clip in front of them.
+    if (this->playing || this->command.getUseAuto())
+        return false;
+
+    if (this->loaded)
+        return true;
+
+    const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
+    if (device == NULL || !device->isConnected())
+        return false;
+
+    // Always into the background, what is on air is left untouched until the item is played.
+    device->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
+                      this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
+                      this->command.getDirection(), false);
+
     foreach (const DeviceModel& model, DeviceManager::getInstance().getDeviceModels())
     {
         if (model.getShadow() == "No")
             continue;
 
-        const QSharedPointer<CasparDevice>  deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
+        const QSharedPointer<CasparDevice> deviceShadow = DeviceManager::getInstance().getDeviceByName(model.getName());
         if (deviceShadow != NULL && deviceShadow->isConnected())
-        {
             deviceShadow->loadStill(this->command.getChannel(), this->command.getVideolayer(), this->command.getImageName(),
                                     this->command.getTransition(), this->command.getTransitionDuration(), this->command.getTween(),
-                                    this->command.getDirection(), this->command.getUseAuto());
-        }
+                                    this->command.getDirection(), false);
     }
 
+    // The next play takes the loaded image instead of opening it again.
     this->loaded = true;
-    this->paused = false;
-    this->playing = false;
+
+    return true;
+}
+
+void RundownStillWidget::releasePreroll()
+{
+    if (!this->playing)
+        this->loaded = false;
 }
 
 void RundownStillWidget::executeClearVideolayer()
@@ -742,17 +788,38 @@ void RundownStillWidget::remoteTriggerIdChanged(const QString& remoteTriggerId)
     this->labelRemoteTriggerId->setText(QString("UID: %1").arg(remoteTriggerId));
 }
 
+void RundownStillWidget::commandChanged()
+{
+    // The loaded image no longer matches the item, it's loaded again as edited.
+    releasePreroll();
+}
+
 void RundownStillWidget::deviceConnectionStateChanged(CasparDevice& device)
 {
     Q_UNUSED(device);
 
+    // The background is gone with the connection, or with the server if it was restarted.
+    releasePreroll();
+
     checkDeviceConnection();
 }
 
+void RundownStillWidget::deviceLayerCleared(int channel, int videolayer, CasparDevice& device)
+{
+    Q_UNUSED(device);
+
+    // Cleared by any item, the loaded image is opened again when played.
+    if (channel == this->command.getChannel() && (videolayer == -1 || videolayer == this->command.getVideolayer()))
+        releasePreroll();
+}
+
 void RundownStillWidget::deviceAdded(CasparDevice& device)
 {
     if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress())->getName() == this->model.getDeviceName())
+    {
         QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(&device, SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     checkDeviceConnection();
 }
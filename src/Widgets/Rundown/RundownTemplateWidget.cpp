@@ -3,9 +3,11 @@
 #include "Global.h"
 
 #include "DatabaseManager.h"
+#include "CommandScheduler.h"
 #include "DeviceManager.h"
 #include "GpiManager.h"
 #include "EventManager.h"
+#include "LiveDataManager.h"
 #include "Animations/ActiveAnimation.h"
 #include "Events/ConnectionStateChangedEvent.h"
 #include "Events/Inspector/AddTemplateDataEvent.h"
@@ -53,6 +55,10 @@ RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget*
     this->executeTimer.setSingleShot(true);
     this->executePreviewTimer.setSingleShot(true);
 
+    this->liveDataTimer.setSingleShot(true);
+    QObject::connect(&this->liveDataTimer, SIGNAL(timeout()), this, SLOT(scheduleLiveDataUpdate()));
+
+    QObject::connect(&this->command, SIGNAL(liveDataChanged()), this, SLOT(scheduleLiveDataUpdate()));
     QObject::connect(&this->command, SIGNAL(channelChanged(int)), this, SLOT(channelChanged(int)));
     QObject::connect(&this->command, SIGNAL(videolayerChanged(int)), this, SLOT(videolayerChanged(int)));
     QObject::connect(&this->command, SIGNAL(delayChanged(int)), this, SLOT(delayChanged(int)));
@@ -66,7 +72,10 @@ RundownTemplateWidget::RundownTemplateWidget(const LibraryModel& model, QWidget*
     QObject::connect(&DeviceManager::getInstance(), SIGNAL(deviceAdded(CasparDevice&)), this, SLOT(deviceAdded(CasparDevice&)));
     const QSharedPointer<CasparDevice> device = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
     if (device != NULL)
+    {
         QObject::connect(device.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(device.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(connectionStateChanged(bool, GpiDevice*)), this, SLOT(gpiConnectionStateChanged(bool, GpiDevice*)));
 
@@ -118,7 +127,14 @@ void RundownTemplateWidget::deviceChanged(const DeviceChangedEvent& event)
         // Disconnect connectionStateChanged() from the old device.
         const QSharedPointer<CasparDevice> oldDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (oldDevice != NULL)
+        {
             QObject::disconnect(oldDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::disconnect(oldDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
+
+        // What is on air stays on the old device.
+        this->onAir = false;
+        this->liveDataTimer.stop();
 
         // Update the model with the new device.
         this->model.setDeviceName(event.getDeviceName());
@@ -127,7 +143,10 @@ void RundownTemplateWidget::deviceChanged(const DeviceChangedEvent& event)
         // Connect connectionStateChanged() to the new device.
         const QSharedPointer<CasparDevice> newDevice = DeviceManager::getInstance().getDeviceByName(this->model.getDeviceName());
         if (newDevice != NULL)
+        {
             QObject::connect(newDevice.data(), SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+            QObject::connect(newDevice.data(), SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+        }
     }
 
     checkEmptyDevice();
@@ -234,6 +253,11 @@ void RundownTemplateWidget::setSelected(bool selected)
     this->selected = selected;
 }
 
+bool RundownTemplateWidget::isLive() const
+{
+    return this->onAir && LiveDataManager::getInstance().ownsLayer(getLiveDataKey(), const_cast<RundownTemplateWidget*>(this));
+}
+
 void RundownTemplateWidget::setActive(bool active)
 {
     this->active = active;
@@ -281,6 +305,8 @@ void RundownTemplateWidget::clearDelayedCommands()
 
 void RundownTemplateWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -295,6 +321,11 @@ void RundownTemplateWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownTemplateWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -317,21 +348,18 @@ bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                     QTimer::singleShot(startDelay + stopDelay, this, SLOT(executeStop()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStop()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executeTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStop()));
             }
 
             this->executeTimer.start();
@@ -357,8 +385,8 @@ bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[this->command.getChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executeTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), this->command.getChannel());
+                this->executeTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
@@ -408,21 +436,18 @@ bool RundownTemplateWidget::executeCommand(Playout::PlayoutType type)
 
                 double framesPerSecond = DatabaseManager::getInstance().getFormat(channelFormats[deviceModel->getPreviewChannel() - 1]).getFramesPerSecond().toDouble();
 
-                int startDelay = floor(this->command.getDelay() * (1000 / framesPerSecond));
-                this->executePreviewTimer.setInterval(startDelay);
+                QString frameClock = CommandScheduler::getFrameClock(this->model.getDeviceName(), deviceModel->getPreviewChannel());
+                this->executePreviewTimer.setFrameInterval(this->command.getDelay(), framesPerSecond, frameClock);
 
                 if (this->command.getDuration() > 0)
-                {
-                    int stopDelay = floor(this->command.getDuration() * (1000 / framesPerSecond));
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStopPreview()));
-                }
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), framesPerSecond, frameClock, this, SLOT(executeStopPreview()));
             }
             else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
             {
                 this->executePreviewTimer.setInterval(this->command.getDelay());
 
                 if (this->command.getDuration() > 0)
-                    QTimer::singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStopPreview()));
+                    CommandScheduler::getInstance().singleShot(this->command.getDelay() + this->command.getDuration(), this, SLOT(executeStopPreview()));
             }
 
             this->executePreviewTimer.start();
@@ -468,6 +493,8 @@ void RundownTemplateWidget::executeStop()
     }
 
     this->loaded = false;
+    this->onAir = false;
+    this->liveDataTimer.stop();
 }
 
 void RundownTemplateWidget::executeStopPreview()
@@ -543,7 +570,14 @@ void RundownTemplateWidget::executePlay()
     if (this->markUsedItems)
         setUsed(true);
 
+    if (!this->loaded)
+        setSentTemplateData();
+
     this->loaded = false;
+    this->onAir = true;
+
+    // Any other item on air on this template layer stops sending its live data.
+    LiveDataManager::getInstance().claimLayer(getLiveDataKey(), this);
 }
 
 void RundownTemplateWidget::executePlayPreview()
@@ -614,6 +648,8 @@ void RundownTemplateWidget::executeLoad()
         }
     }
 
+    setSentTemplateData();
+
     this->loaded = true;
 }
 
@@ -655,6 +691,48 @@ void RundownTemplateWidget::executeUpdate()
                                          this->command.getFlashlayer(), this->command.getTemplateData());
         }
     }
+
+    setSentTemplateData();
+}
+
+void RundownTemplateWidget::setSentTemplateData()
+{
+    this->sentTemplateData = this->command.getTemplateData();
+}
+
+QString RundownTemplateWidget::getLiveDataKey() const
+{
+    return QString("%1/%2/%3/%4").arg(this->model.getDeviceName()).arg(this->command.getChannel())
+                                 .arg(this->command.getVideolayer()).arg(this->command.getFlashlayer());
+}
+
+void RundownTemplateWidget::scheduleLiveDataUpdate()
+{
+    if (!this->onAir || this->liveDataTimer.isActive())
+        return;
+
+    QString key = getLiveDataKey();
+
+    // Another item has been played on the template layer since.
+    if (!LiveDataManager::getInstance().ownsLayer(key, this))
+    {
+        this->onAir = false;
+        return;
+    }
+
+    // Nothing is sent when the bound values changed back to what is on air.
+    if (this->command.getTemplateData() == this->sentTemplateData)
+        return;
+
+    // Updates to the same template layer are limited to one per update interval, values changed meanwhile are sent together.
+    int delay = LiveDataManager::getInstance().reserveUpdate(key);
+    if (delay > 0)
+    {
+        this->liveDataTimer.start(delay);
+        return;
+    }
+
+    executeUpdate();
 }
 
 void RundownTemplateWidget::executeInvoke()
@@ -709,6 +787,8 @@ void RundownTemplateWidget::executeClear()
     }
 
     this->loaded = false;
+    this->onAir = false;
+    this->liveDataTimer.stop();
 }
 
 void RundownTemplateWidget::executeClearVideolayer()
@@ -744,6 +824,8 @@ void RundownTemplateWidget::executeClearVideolayer()
     }
 
     this->loaded = false;
+    this->onAir = false;
+    this->liveDataTimer.stop();
 }
 
 void RundownTemplateWidget::executeClearChannel()
@@ -788,6 +870,8 @@ void RundownTemplateWidget::executeClearChannel()
 
 
     this->loaded = false;
+    this->onAir = false;
+    this->liveDataTimer.stop();
 }
 
 void RundownTemplateWidget::channelChanged(int channel)
@@ -960,13 +1044,32 @@ void RundownTemplateWidget::deviceConnectionStateChanged(CasparDevice& device)
 {
     Q_UNUSED(device);
 
+    // A reconnected server may have been restarted, the template is no longer on air.
+    this->onAir = false;
+    this->liveDataTimer.stop();
+
     checkDeviceConnection();
 }
 
+void RundownTemplateWidget::deviceLayerCleared(int channel, int videolayer, CasparDevice& device)
+{
+    Q_UNUSED(device);
+
+    // Cleared by any item, live data is no longer sent to the layer.
+    if (channel == this->command.getChannel() && (videolayer == -1 || videolayer == this->command.getVideolayer()))
+    {
+        this->onAir = false;
+        this->liveDataTimer.stop();
+    }
+}
+
 void RundownTemplateWidget::deviceAdded(CasparDevice& device)
 {
     if (DeviceManager::getInstance().getDeviceModelByAddress(device.getAddress())->getName() == this->model.getDeviceName())
+    {
         QObject::connect(&device, SIGNAL(connectionStateChanged(CasparDevice&)), this, SLOT(deviceConnectionStateChanged(CasparDevice&)));
+        QObject::connect(&device, SIGNAL(layerCleared(int, int, CasparDevice&)), this, SLOT(deviceLayerCleared(int, int, CasparDevice&)));
+    }
 
     checkDeviceConnection();
 }
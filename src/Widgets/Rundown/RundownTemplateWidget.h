@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -57,7 +58,9 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
+        virtual bool isLive() const;
 
     protected:
         virtual bool eventFilter(QObject* target, QEvent* event);
@@ -76,6 +79,10 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         QString delayType;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
+        bool onAir = false;
+        QString sentTemplateData;
+        QTimer liveDataTimer;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -89,13 +96,15 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
-        QTimer executePreviewTimer;
+        ScheduledTimer executeTimer;
+        ScheduledTimer executePreviewTimer;
 
         void checkEmptyDevice();
         void checkGpiConnection();
         void checkDeviceConnection();
         void configureOscSubscriptions();
+        void setSentTemplateData();
+        QString getLiveDataKey() const;
 
         Q_SLOT void channelChanged(int);
         Q_SLOT void executeStop();
@@ -107,6 +116,7 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         Q_SLOT void executeClear();
         Q_SLOT void executeClearVideolayer();
         Q_SLOT void executeClearChannel();
+        Q_SLOT void scheduleLiveDataUpdate();
         Q_SLOT void executePlayPreview();
         Q_SLOT void executeStopPreview();
         Q_SLOT void videolayerChanged(int);
@@ -116,6 +126,7 @@ class WIDGETS_EXPORT RundownTemplateWidget : public QWidget, Ui::RundownTemplate
         Q_SLOT void remoteTriggerIdChanged(const QString&);
         Q_SLOT void gpiConnectionStateChanged(bool, GpiDevice*);
         Q_SLOT void deviceConnectionStateChanged(CasparDevice&);
+        Q_SLOT void deviceLayerCleared(int, int, CasparDevice&);
         Q_SLOT void deviceAdded(CasparDevice&);
         Q_SLOT void stopControlSubscriptionReceived(const QString&, const QList<QVariant>&);
         Q_SLOT void playControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -1,6 +1,9 @@
 #include "RundownTreeBaseWidget.h"
 #include "RundownItemFactory.h"
 #include "RundownGroupWidget.h"
+#include "RundownItemDelegate.h"
+#include "RundownJournal.h"
+#include "RundownReader.h"
 
 #include "DatabaseManager.h"
 #include "EventManager.h"
@@ -9,11 +12,14 @@
 #include "Events/Rundown/RepositoryRundownEvent.h"
 #include "Events/Rundown/RemoveItemFromAutoPlayQueueEvent.h"
 #include "Events/Rundown/CurrentItemChangedEvent.h"
+#include "Events/StatusbarEvent.h"
 #include "Models/LibraryModel.h"
 
 #include <iostream>
 
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QTime>
+#include <QtCore/QTimer>
 #include <QtCore/QDebug>
 
 #include <QtGui/QDrag>
@@ -23,13 +29,32 @@
 #include <QtWidgets/QApplication>
 
 RundownTreeBaseWidget::RundownTreeBaseWidget(QWidget* parent)
-    : QTreeWidget(parent), compactView(false), theme(""), lock(false)
+    : QTreeWidget(parent), compactView(false), theme(""), lock(false), insertDepth(0), viewportUpdateScheduled(false), reader(NULL), loadConstructionTime(0),
+      journal(NULL), changeCount(0), nextItemId(0), changesScheduled(false)
 {
     this->theme = DatabaseManager::getInstance().getConfigurationByName("Theme").getValue();
 
+    // Rows scrolled out of view have no widget, they are painted by the delegate.
+    QTreeWidget::setItemDelegate(new RundownItemDelegate(this));
+
+    QObject::connect(this, SIGNAL(currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*)), this, SLOT(trackCurrentItem(QTreeWidgetItem*, QTreeWidgetItem*)));
+    QObject::connect(this, SIGNAL(itemExpanded(QTreeWidgetItem*)), this, SLOT(itemExpandedChanged(QTreeWidgetItem*)));
+    QObject::connect(this, SIGNAL(itemCollapsed(QTreeWidgetItem*)), this, SLOT(itemExpandedChanged(QTreeWidgetItem*)));
+    QObject::connect(this, SIGNAL(itemSelectionChanged()), this, SLOT(wakeSelectedItems()));
+
     QObject::connect(&EventManager::getInstance(), SIGNAL(repositoryRundown(const RepositoryRundownEvent&)), this, SLOT(repositoryRundown(const RepositoryRundownEvent&)));
 }
 
+RundownTreeBaseWidget::~RundownTreeBaseWidget()
+{
+    if (this->reader != NULL)
+    {
+        this->reader->disconnect(); // Disconnect all events.
+        this->reader->cancel();
+        this->reader->wait();
+    }
+}
+
 bool RundownTreeBaseWidget::getCompactView() const
 {
     return this->compactView;
@@ -38,6 +63,9 @@ bool RundownTreeBaseWidget::getCompactView() const
 void RundownTreeBaseWidget::setCompactView(bool compactView)
 {
     this->compactView = compactView;
+
+    // Rows without a widget take their height from the delegate.
+    QTreeWidget::scheduleDelayedItemsLayout();
 }
 
 void RundownTreeBaseWidget::writeProperties(QTreeWidgetItem* item, QXmlStreamWriter* writer) const
@@ -113,22 +141,25 @@ AbstractRundownWidget* RundownTreeBaseWidget::readProperties(boost::property_tre
     return widget;
 }
 
-bool RundownTreeBaseWidget::copySelectedItems() const
+QString RundownTreeBaseWidget::serializeSelectedItems() const
 {
     QString data;
-    QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
+    QXmlStreamWriter writer(&data);
 
-    writer->writeStartDocument();
-    writer->writeStartElement("items");
+    writer.writeStartDocument();
+    writer.writeStartElement("items");
     for (int i = 0; i < QTreeWidget::selectedItems().count(); i++)
-        writeProperties(QTreeWidget::selectedItems().at(i), writer);
+        writeProperties(QTreeWidget::selectedItems().at(i), &writer);
 
-    writer->writeEndElement();
-    writer->writeEndDocument();
+    writer.writeEndElement();
+    writer.writeEndDocument();
 
-    qApp->clipboard()->setText(data);
+    return data;
+}
 
-    delete writer;
+bool RundownTreeBaseWidget::copySelectedItems() const
+{
+    qApp->clipboard()->setText(serializeSelectedItems());
 
     return true;
 }
@@ -156,7 +187,17 @@ bool RundownTreeBaseWidget::pasteItemProperties()
         {
             AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
             if (widget->getLibraryModel()->getType() == type)
+            {
                 widget->getCommand()->readProperties(parentValue.second);
+                markItemChanged(item);
+
+                // The story id might have changed.
+                if (item->parent() == NULL)
+                {
+                    unindexItem(item);
+                    this->unindexedItems.insert(item);
+                }
+            }
         }
     }
 
@@ -165,103 +206,669 @@ bool RundownTreeBaseWidget::pasteItemProperties()
 
 bool RundownTreeBaseWidget::pasteSelectedItems(bool repositoryRundown)
 {
-    QTime time;
-    time.start();
-
-    std::wstringstream wstringstream;
-    wstringstream << qApp->clipboard()->text().toStdWString();
+    return pasteItems(qApp->clipboard()->text(), repositoryRundown);
+}
 
-    int offset = 1; // Drop offset.
-    boost::property_tree::wptree pt;
-    boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+bool RundownTreeBaseWidget::pasteItems(const QString& data, bool repositoryRundown)
+{
+    EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
 
-    if (pt.get_child(L"items").count(L"allowremotetriggering") > 0)
+    // Paste below the current item, inside its group if it has one. Without a
+    // current item, e.g. when dropping a preset, we add to the bottom of the rundown.
+    QTreeWidgetItem* parentItem = QTreeWidget::invisibleRootItem();
+    int index = -1;
+    if (QTreeWidget::currentItem() != NULL)
     {
-        bool allowRemoteTriggering = pt.get_child(L"items").get(L"allowremotetriggering", false);
-        EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(allowRemoteTriggering));
+        if (QTreeWidget::currentItem()->parent() != NULL)
+            parentItem = QTreeWidget::currentItem()->parent();
+
+        index = QTreeWidget::currentIndex().row() + 1;
     }
 
+    QXmlStreamReader reader(data);
+
+    return insertItems(reader, parentItem, index);
+}
+
+void RundownTreeBaseWidget::loadItems(const QByteArray& data, bool repositoryRundown)
+{
+    cancelLoad();
+
     EventManager::getInstance().fireRepositoryRundownEvent(RepositoryRundownEvent(repositoryRundown));
 
-    BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
+    this->loadTimer.start();
+    this->loadConstructionTime = 0;
+
+    this->reader = new RundownReader(data, this);
+    QObject::connect(this->reader, SIGNAL(itemsAvailable()), this, SLOT(processLoadedItems()));
+    QObject::connect(this->reader, SIGNAL(finished()), this, SLOT(processLoadedItems()));
+    QObject::connect(this->reader, SIGNAL(allowRemoteTriggeringRead(bool)), this, SLOT(allowRemoteTriggeringRead(bool)));
+    this->reader->start();
+}
+
+bool RundownTreeBaseWidget::isLoading() const
+{
+    return this->reader != NULL;
+}
+
+void RundownTreeBaseWidget::cancelLoad()
+{
+    if (this->reader == NULL)
+        return;
+
+    qDebug("Cancelled loading of rundown after %d items", QTreeWidget::invisibleRootItem()->childCount());
+
+    this->reader->disconnect(); // Disconnect all events.
+    this->reader->cancel();
+    this->reader->wait();
+
+    delete this->reader;
+    this->reader = NULL;
+
+    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Opening rundown cancelled"));
+}
+
+void RundownTreeBaseWidget::processLoadedItems()
+{
+    if (this->reader == NULL)
+        return;
+
+    // Once the reader has finished nothing more is queued, so everything left can be drained.
+    bool finished = this->reader->isFinished();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    // Construct widgets in short slices so the rundown stays usable while loading.
+    bool drained = false;
+    beginInsert();
+    while (!drained && (finished || timer.elapsed() < Rundown::LOAD_SLICE_DURATION))
+    {
+        QList<boost::property_tree::wptree> items = this->reader->takeItems(Rundown::LOAD_BATCH_SIZE);
+        for (int i = 0; i < items.count(); i++)
+        {
+            if (insertItem(items[i], QTreeWidget::invisibleRootItem(), -1))
+                registerItem(QTreeWidget::invisibleRootItem()->child(QTreeWidget::invisibleRootItem()->childCount() - 1));
+        }
+
+        drained = (items.count() < Rundown::LOAD_BATCH_SIZE);
+    }
+    endInsert();
+
+    this->loadConstructionTime += timer.elapsed();
+
+    // The first items are playable right away.
+    if (QTreeWidget::currentItem() == NULL && QTreeWidget::invisibleRootItem()->childCount() > 0)
+        QTreeWidget::setCurrentItem(QTreeWidget::invisibleRootItem()->child(0));
+
+    if (finished)
+    {
+        qDebug("RundownTreeBaseWidget::loadItems %lld msec, construction %lld msec (%d items)",
+               this->loadTimer.elapsed(), this->loadConstructionTime, QTreeWidget::invisibleRootItem()->childCount());
+
+        this->reader->deleteLater();
+        this->reader = NULL;
+
+        EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
+
+        emit loadFinished();
+    }
+    else
+    {
+        EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(QString("Opening rundown... %1%").arg(this->reader->getProgress())));
+
+        // More is waiting, otherwise the reader signals when the next item is queued.
+        if (!drained)
+            QTimer::singleShot(0, this, SLOT(processLoadedItems()));
+    }
+}
+
+void RundownTreeBaseWidget::allowRemoteTriggeringRead(bool allowRemoteTriggering)
+{
+    EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(allowRemoteTriggering));
+}
+
+void RundownTreeBaseWidget::beginInsert()
+{
+    if (this->insertDepth++ == 0)
+        QTreeWidget::setUpdatesEnabled(false);
+}
+
+void RundownTreeBaseWidget::endInsert()
+{
+    if (--this->insertDepth > 0)
+        return;
+
+    QTreeWidget::setUpdatesEnabled(true);
+    QTreeWidget::doItemsLayout(); // Refresh
+
+    checkEmptyRundown();
+}
+
+void RundownTreeBaseWidget::setJournal(RundownJournal* journal)
+{
+    this->journal = journal;
+}
+
+int RundownTreeBaseWidget::getChangeCount() const
+{
+    return this->changeCount;
+}
+
+void RundownTreeBaseWidget::markRundownChanged()
+{
+    this->changeCount++;
+}
+
+void RundownTreeBaseWidget::markItemChanged(QTreeWidgetItem* item)
+{
+    if (item == NULL)
+        return;
+
+    // Edits are tracked per top-level item, a group is written as a whole.
+    while (item->parent() != NULL)
+        item = item->parent();
+
+    this->changedItems.insert(getItemId(item));
+
+    scheduleChanges();
+}
+
+void RundownTreeBaseWidget::resetChanges()
+{
+    this->changesScheduled = false;
+    this->changeCount = 0;
+    this->journalItems.clear();
+    this->changedItems.clear();
+
+    for (int i = 0; i < QTreeWidget::invisibleRootItem()->childCount(); i++)
+        registerItem(QTreeWidget::invisibleRootItem()->child(i));
+}
+
+void RundownTreeBaseWidget::registerItem(QTreeWidgetItem* item)
+{
+    // Items read from the rundown document are already part of it.
+    quint64 id = getItemId(item);
+
+    this->journalItems.append(id);
+    this->changedItems.remove(id);
+}
+
+quint64 RundownTreeBaseWidget::getItemId(QTreeWidgetItem* item)
+{
+    quint64 id = item->data(0, Qt::UserRole).toULongLong();
+    if (id == 0)
     {
-        if (parentValue.first != L"item")
+        id = ++this->nextItemId;
+        item->setData(0, Qt::UserRole, id);
+    }
+
+    return id;
+}
+
+QByteArray RundownTreeBaseWidget::serializeItem(QTreeWidgetItem* item) const
+{
+    QByteArray data;
+    QXmlStreamWriter writer(&data);
+    writeProperties(item, &writer);
+
+    return data;
+}
+
+void RundownTreeBaseWidget::scheduleChanges()
+{
+    if (this->changesScheduled)
+        return;
+
+    // Coalesce everything changed by the current operation.
+    this->changesScheduled = true;
+    QTimer::singleShot(0, this, SLOT(processChanges()));
+}
+
+void RundownTreeBaseWidget::processChanges()
+{
+    commitChanges();
+}
+
+void RundownTreeBaseWidget::commitChanges()
+{
+    if (!this->changesScheduled)
+        return;
+
+    this->changesScheduled = false;
+
+    bool journaling = (this->journal != NULL && this->journal->isOpen());
+
+    QTreeWidgetItem* rootItem = QTreeWidget::invisibleRootItem();
+
+    QList<quint64> items;
+    items.reserve(rootItem->childCount());
+    for (int i = 0; i < rootItem->childCount(); i++)
+        items.append(getItemId(rootItem->child(i)));
+
+    // Replay the difference to the last journaled order, only the items touched are serialized.
+    int count = 0;
+    QList<quint64> journalItems = this->journalItems;
+    QSet<quint64> currentItems = items.toSet();
+    for (int row = journalItems.count() - 1; row >= 0; row--)
+    {
+        if (currentItems.contains(journalItems.at(row)))
             continue;
 
-        AbstractRundownWidget* parentWidget = readProperties(parentValue.second);
+        journalItems.removeAt(row);
+        if (journaling)
+            this->journal->removeItem(row);
 
-        int row  = QTreeWidget::currentIndex().row();
+        count++;
+    }
+
+    QSet<quint64> insertedItems;
+    for (int row = 0; row < items.count(); row++)
+    {
+        quint64 id = items.at(row);
+        if (row < journalItems.count() && journalItems.at(row) == id)
+            continue;
 
-        QTreeWidgetItem* parentItem = new QTreeWidgetItem();
-        if (QTreeWidget::currentItem() == NULL || QTreeWidget::currentItem()->parent() == NULL) // Top level item.
+        int from = journalItems.indexOf(id, row);
+        if (from != -1)
         {
-            parentWidget->setInGroup(false);
-            parentWidget->setExpanded(false);
-
-            // If we don't have a selected row then we add the item to the bottom of the
-            // rundown. This can be the case when we drag and drop a preset to the rundown.
-            if (row != -1)
-                QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
-            else
-                QTreeWidget::invisibleRootItem()->addChild(parentItem);
+            journalItems.move(from, row);
+            if (journaling)
+                this->journal->moveItem(from, row);
         }
         else
         {
-            if (parentWidget->isGroup())
-                continue; // We don't support group in groups.
+            journalItems.insert(row, id);
+            if (journaling)
+            {
+                wakeItem(rootItem->child(row));
+                this->journal->insertItem(row, serializeItem(rootItem->child(row)));
+            }
 
-            parentWidget->setInGroup(true);
+            insertedItems.insert(id);
+        }
+
+        count++;
+    }
+
+    foreach (quint64 id, this->changedItems)
+    {
+        int row = items.indexOf(id);
+        if (row == -1 || insertedItems.contains(id))
+            continue;
 
-            QTreeWidget::currentItem()->parent()->insertChild(row + offset++, parentItem);
+        if (journaling)
+        {
+            wakeItem(rootItem->child(row));
+            this->journal->updateItem(row, serializeItem(rootItem->child(row)));
         }
 
-        QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
-        //QTreeWidget::setCurrentItem(parentItem);
+        count++;
+    }
+
+    this->journalItems = items;
+    this->changedItems.clear();
+
+    if (count > 0)
+        this->changeCount++;
+
+    // Items may have been replaced by a clone.
+    trackCurrentCommand();
+}
+
+void RundownTreeBaseWidget::hibernateItems(const QSet<QTreeWidgetItem*>& liveItems)
+{
+    if (isLoading())
+        return;
+
+    // Pending changes are journaled from the widgets about to be released.
+    commitChanges();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    int count = this->hibernatedItems.count();
 
-        if (parentWidget->isGroup())
+    // Rows on screen are shown and the selection is worked on, they keep their widgets.
+    QSet<QTreeWidgetItem*> keptItems = liveItems;
+    foreach (QTreeWidgetItem* item, getViewportItems(Rundown::VIEWPORT_MARGIN))
+        keptItems.insert(item);
+
+    foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
+    {
+        QTreeWidgetItem* groupItem = (item->parent() != NULL) ? item->parent() : item;
+
+        keptItems.insert(groupItem);
+        for (int i = 0; i < groupItem->childCount(); i++)
+            keptItems.insert(groupItem->child(i));
+    }
+
+    QTreeWidgetItem* rootItem = QTreeWidget::invisibleRootItem();
+    for (int i = 0; i < rootItem->childCount(); i++)
+    {
+        QTreeWidgetItem* item = rootItem->child(i);
+        for (int j = 0; j < item->childCount(); j++)
         {
-            bool expanded = parentValue.second.get(L"expanded", false);
-            parentItem->setExpanded(expanded);
-            parentWidget->setExpanded(expanded);
+            if (!keptItems.contains(item->child(j)))
+                hibernateItem(item->child(j));
+        }
 
-            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
-            {
-                AbstractRundownWidget* childWidget = readProperties(childValue.second);
-                childWidget->setInGroup(true);
+        if (!keptItems.contains(item))
+            hibernateItem(item);
+    }
 
-                QTreeWidgetItem* childItem = new QTreeWidgetItem();
-                parentItem->addChild(childItem);
+    count = this->hibernatedItems.count() - count;
+    if (count > 0)
+        qDebug("Hibernated %d rundown items in %lld msec", count, timer.elapsed());
+}
 
-                QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
-            }
+void RundownTreeBaseWidget::wakeItems()
+{
+    if (this->hibernatedItems.isEmpty())
+        return;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    int count = this->hibernatedItems.count();
+
+    beginInsert();
+    foreach (QTreeWidgetItem* item, this->hibernatedItems.keys())
+        restoreItem(item);
+
+    endInsert();
+
+    qDebug("Woke %d rundown items in %lld msec", count, timer.elapsed());
+
+    scheduleViewportUpdate();
+}
+
+void RundownTreeBaseWidget::wakeItem(QTreeWidgetItem* item)
+{
+    if (item == NULL || this->hibernatedItems.isEmpty())
+        return;
+
+    // A group executes its items and an item reads its group, they are woken together.
+    QTreeWidgetItem* groupItem = (item->parent() != NULL) ? item->parent() : item;
+
+    restoreItem(groupItem);
+    for (int i = 0; i < groupItem->childCount(); i++)
+        restoreItem(groupItem->child(i));
+
+    scheduleViewportUpdate();
+}
+
+bool RundownTreeBaseWidget::isHibernated() const
+{
+    return !this->hibernatedItems.isEmpty();
+}
+
+QByteArray RundownTreeBaseWidget::serializeWidget(QTreeWidgetItem* item) const
+{
+    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+
+    QByteArray data;
+    QXmlStreamWriter writer(&data);
+
+    // Like writeProperties() but without the items of a group, they are hibernated on their own.
+    writer.writeStartElement("item");
+    writer.writeTextElement("type", widget->getLibraryModel()->getType());
+    writer.writeTextElement("devicename", widget->getLibraryModel()->getDeviceName());
+    writer.writeTextElement("label", widget->getLibraryModel()->getLabel());
+    writer.writeTextElement("name", widget->getLibraryModel()->getName());
+    writer.writeTextElement("used", (widget->isUsed() == true ? "true" : "false"));
+    widget->getCommand()->writeProperties(&writer);
+    widget->writeProperties(&writer);
+    writer.writeEndElement();
+
+    return data;
+}
+
+void RundownTreeBaseWidget::hibernateItem(QTreeWidgetItem* item)
+{
+    if (this->hibernatedItems.contains(item) || QTreeWidget::itemWidget(item, 0) == NULL)
+        return;
+
+    this->hibernatedItems.insert(item, serializeWidget(item));
+
+    // The delegate paints the row from these until the widget is restored.
+    AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+    item->setData(0, Rundown::LABEL_ROLE, widget->getLibraryModel()->getLabel());
+    item->setData(0, Rundown::COLOR_ROLE, widget->getColor());
+
+    QTreeWidget::removeItemWidget(item, 0); // Deletes the widget along with its timers and subscriptions.
+}
+
+void RundownTreeBaseWidget::restoreItem(QTreeWidgetItem* item)
+{
+    if (!this->hibernatedItems.contains(item))
+        return;
+
+    QXmlStreamReader reader(this->hibernatedItems.take(item));
+    if (!reader.readNextStartElement())
+        return;
+
+    boost::property_tree::wptree pt;
+    RundownReader::readElement(reader, pt);
+
+    AbstractRundownWidget* widget = readProperties(pt);
+    widget->setInGroup(item->parent() != NULL);
+    widget->setExpanded(item->isExpanded());
+
+    if (pt.get(L"used", false))
+        widget->setUsed(true);
+
+    QTreeWidget::setItemWidget(item, 0, dynamic_cast<QWidget*>(widget));
+
+    item->setData(0, Rundown::LABEL_ROLE, QVariant());
+    item->setData(0, Rundown::COLOR_ROLE, QVariant());
+}
+
+void RundownTreeBaseWidget::wakeSelectedItems()
+{
+    // Edits, copies and moves work on the widgets of the selected items.
+    foreach (QTreeWidgetItem* item, QTreeWidget::selectedItems())
+        wakeItem(item);
+}
+
+void RundownTreeBaseWidget::trackCurrentItem(QTreeWidgetItem* current, QTreeWidgetItem* previous)
+{
+    Q_UNUSED(previous);
+
+    // Selected in a hibernated rundown, e.g. by a GPI or OSC control.
+    wakeItem(current);
+
+    trackCurrentCommand();
+}
+
+void RundownTreeBaseWidget::trackCurrentCommand()
+{
+    AbstractCommand* command = NULL;
+    if (QTreeWidget::currentItem() != NULL && QTreeWidget::itemWidget(QTreeWidget::currentItem(), 0) != NULL)
+        command = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(QTreeWidget::currentItem(), 0))->getCommand();
+
+    if (command == this->trackedCommand)
+        return;
+
+    if (this->trackedCommand != NULL)
+        QObject::disconnect(this->trackedCommand, SIGNAL(changed()), this, SLOT(currentItemModified()));
+
+    // The inspector edits the current item.
+    this->trackedCommand = command;
+    if (command != NULL)
+        QObject::connect(command, SIGNAL(changed()), this, SLOT(currentItemModified()));
+}
+
+void RundownTreeBaseWidget::currentItemModified()
+{
+    markItemChanged(QTreeWidget::currentItem());
+
+    emit currentItemEdited();
+}
+
+void RundownTreeBaseWidget::itemExpandedChanged(QTreeWidgetItem* item)
+{
+    markItemChanged(item);
+}
+
+void RundownTreeBaseWidget::rowsInserted(const QModelIndex& parent, int start, int end)
+{
+    QTreeWidget::rowsInserted(parent, start, end);
+
+    if (parent.isValid())
+        markItemChanged(QTreeWidget::itemFromIndex(parent));
+    else
+    {
+        // The item widget is set after the item is inserted, it's indexed when needed.
+        for (int row = start; row <= end; row++)
+            this->unindexedItems.insert(QTreeWidget::topLevelItem(row));
+
+        scheduleChanges();
+    }
+}
+
+void RundownTreeBaseWidget::rowsAboutToBeRemoved(const QModelIndex& parent, int start, int end)
+{
+    QTreeWidget::rowsAboutToBeRemoved(parent, start, end);
+
+    for (int row = start; row <= end; row++)
+    {
+        QTreeWidgetItem* item = parent.isValid() ? QTreeWidget::itemFromIndex(parent)->child(row) : QTreeWidget::topLevelItem(row);
+
+        this->hibernatedItems.remove(item);
+        for (int i = 0; i < item->childCount(); i++)
+            this->hibernatedItems.remove(item->child(i));
+    }
+
+    if (parent.isValid())
+        markItemChanged(QTreeWidget::itemFromIndex(parent));
+    else
+    {
+        for (int row = start; row <= end; row++)
+            unindexItem(QTreeWidget::topLevelItem(row));
+
+        scheduleChanges();
+    }
+}
+
+bool RundownTreeBaseWidget::insertItems(QXmlStreamReader& reader, QTreeWidgetItem* parentItem, int index)
+{
+    QElapsedTimer timer;
+    qint64 parseTime = 0;
+    qint64 constructionTime = 0;
+    int count = 0;
+
+    // Only a single item is held as a property tree at a time, the rest of the
+    // document is never materialized.
+    if (!reader.readNextStartElement() || reader.name() != "items")
+    {
+        qWarning("Unable to insert rundown items: %s", qPrintable(reader.hasError() ? reader.errorString() : "missing items element"));
+        return false;
+    }
+
+    beginInsert();
+
+    timer.start();
+    while (reader.readNextStartElement())
+    {
+        if (reader.name() == "allowremotetriggering")
+        {
+            bool allowRemoteTriggering = (reader.readElementText() == "true");
+            EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(allowRemoteTriggering));
+
+            continue;
+        }
+        else if (reader.name() != "item")
+        {
+            reader.skipCurrentElement();
+
+            continue;
+        }
+
+        boost::property_tree::wptree pt;
+        RundownReader::readElement(reader, pt);
+
+        parseTime += timer.nsecsElapsed();
+        timer.restart();
+
+        if (insertItem(pt, parentItem, index))
+        {
+            if (index != -1)
+                index++;
+
+            count++;
         }
 
-        QTreeWidget::doItemsLayout(); // Refresh
-        QTreeWidget::repaint();
+        constructionTime += timer.nsecsElapsed();
+        timer.restart();
     }
 
-    checkEmptyRundown();
+    parseTime += timer.nsecsElapsed();
 
-    return true;
+    if (reader.hasError())
+        qWarning("Error while reading rundown items at line %lld: %s", reader.lineNumber(), qPrintable(reader.errorString()));
+
+    timer.restart();
+    endInsert();
+
+    qDebug("RundownTreeBaseWidget::insertItems parse %lld msec, construction %lld msec, layout %lld msec (%d items)",
+           parseTime / 1000000, constructionTime / 1000000, timer.elapsed(), count);
+
+    return !reader.hasError();
 }
 
-bool RundownTreeBaseWidget::duplicateSelectedItems()
+bool RundownTreeBaseWidget::insertItem(boost::property_tree::wptree& pt, QTreeWidgetItem* parentItem, int index)
 {
-    // Save the latest value stored in the clipboard.
-    QString latest = qApp->clipboard()->text();
+    bool inGroup = (parentItem != QTreeWidget::invisibleRootItem());
 
-    if (!copySelectedItems())
-        return true;
+    AbstractRundownWidget* widget = readProperties(pt);
+    if (inGroup && widget->isGroup())
+    {
+        delete widget; // We don't support group in groups.
+        return false;
+    }
+
+    widget->setInGroup(inGroup);
+    if (!inGroup)
+        widget->setExpanded(false);
+
+    QTreeWidgetItem* item = new QTreeWidgetItem();
+    if (index != -1)
+        parentItem->insertChild(index, item);
+    else
+        parentItem->addChild(item);
 
-    if (!pasteSelectedItems())
-        return true;
+    QTreeWidget::setItemWidget(item, 0, dynamic_cast<QWidget*>(widget));
 
-    // Set previous stored clipboard value.
-    qApp->clipboard()->setText(latest);
+    if (widget->isGroup())
+        insertGroupItems(item, widget, pt);
 
     return true;
 }
 
+void RundownTreeBaseWidget::insertGroupItems(QTreeWidgetItem* parentItem, AbstractRundownWidget* parentWidget, boost::property_tree::wptree& pt)
+{
+    bool expanded = pt.get(L"expanded", false);
+    parentItem->setExpanded(expanded);
+    parentWidget->setExpanded(expanded);
+
+    BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, pt.get_child(L"items"))
+    {
+        AbstractRundownWidget* childWidget = readProperties(childValue.second);
+        childWidget->setInGroup(true);
+
+        QTreeWidgetItem* childItem = new QTreeWidgetItem();
+        parentItem->addChild(childItem);
+
+        QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
+    }
+}
+
+bool RundownTreeBaseWidget::duplicateSelectedItems()
+{
+    return pasteItems(serializeSelectedItems());
+}
+
 void RundownTreeBaseWidget::checkEmptyRundown()
 {
     if (this->theme == Appearance::CURVE_THEME)
@@ -307,11 +914,13 @@ void RundownTreeBaseWidget::removeSelectedItems()
 
 void RundownTreeBaseWidget::removeAllItems()
 {
+    cancelLoad();
+
     for (int i = QTreeWidget::invisibleRootItem()->childCount() - 1; i >= 0; i--)
     {
         QTreeWidgetItem* item = QTreeWidget::invisibleRootItem()->child(i);
-        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->isGroup())
+        QWidget* widget = QTreeWidget::itemWidget(item, 0); // Released items have no widget.
+        if (item->childCount() > 0)
         {
             for (int i = item->childCount() - 1; i >= 0; i--)
             {
@@ -715,6 +1324,8 @@ void RundownTreeBaseWidget::moveItemIntoGroup()
         return;
 
     QTreeWidgetItem* currentItemAbove = QTreeWidget::invisibleRootItem()->child(QTreeWidget::currentIndex().row() - 1);
+    wakeItem(currentItemAbove);
+
     if (currentItemAbove != NULL && dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(currentItemAbove, 0))->isGroup()) // Group.
     {
         QTreeWidgetItem* newItem = new QTreeWidgetItem();
@@ -756,6 +1367,14 @@ void RundownTreeBaseWidget::setExpanded(bool expanded)
 
 void RundownTreeBaseWidget::keyPressEvent(QKeyEvent* event)
 {
+    if (isLoading() && event->key() == Qt::Key_Escape)
+    {
+        cancelLoad();
+        emit loadCancelled();
+
+        return;
+    }
+
     if (this->lock)
     {
         if (event->key() == Qt::Key_Insert)
@@ -820,6 +1439,87 @@ void RundownTreeBaseWidget::mousePressEvent(QMouseEvent* event)
     QTreeWidget::mousePressEvent(event);
 }
 
+void RundownTreeBaseWidget::scrollContentsBy(int dx, int dy)
+{
+    QTreeWidget::scrollContentsBy(dx, dy);
+
+    scheduleViewportUpdate();
+}
+
+void RundownTreeBaseWidget::updateGeometries()
+{
+    QTreeWidget::updateGeometries();
+
+    scheduleViewportUpdate();
+}
+
+void RundownTreeBaseWidget::scheduleViewportUpdate()
+{
+    if (this->viewportUpdateScheduled)
+        return;
+
+    this->viewportUpdateScheduled = true;
+    QTimer::singleShot(0, this, SLOT(updateViewport()));
+}
+
+QList<QTreeWidgetItem*> RundownTreeBaseWidget::getViewportItems(int margin) const
+{
+    QTreeWidgetItem* item = QTreeWidget::itemAt(0, 0);
+    for (int i = 0; item != NULL && i < margin && QTreeWidget::itemAbove(item) != NULL; i++)
+        item = QTreeWidget::itemAbove(item);
+
+    // Only walk the rows on screen, the cost does not depend on the rundown size.
+    QList<QTreeWidgetItem*> items;
+    int height = QTreeWidget::viewport()->height();
+    int below = 0;
+    for (; item != NULL; item = QTreeWidget::itemBelow(item))
+    {
+        if (QTreeWidget::visualItemRect(item).top() >= height && below++ >= margin)
+            break;
+
+        items.append(item);
+    }
+
+    return items;
+}
+
+void RundownTreeBaseWidget::updateViewport()
+{
+    this->viewportUpdateScheduled = false;
+
+    // Rows scrolled in get their widget back, with a few rows around them so scrolling rarely shows the delegate.
+    if (!this->hibernatedItems.isEmpty())
+    {
+        foreach (QTreeWidgetItem* item, getViewportItems(Rundown::VIEWPORT_MARGIN))
+            restoreItem(item);
+    }
+
+    QList<QPointer<QWidget>> widgets;
+    foreach (QTreeWidgetItem* item, getViewportItems(0))
+    {
+        QWidget* widget = QTreeWidget::itemWidget(item, 0);
+        if (widget != NULL)
+            widgets.append(widget);
+    }
+
+    foreach (const QPointer<QWidget>& widget, this->viewportWidgets)
+    {
+        if (!widget.isNull() && !widgets.contains(widget))
+            dynamic_cast<AbstractRundownWidget*>(widget.data())->setInViewport(false);
+    }
+
+    foreach (const QPointer<QWidget>& widget, widgets)
+    {
+        if (!this->viewportWidgets.contains(widget))
+            dynamic_cast<AbstractRundownWidget*>(widget.data())->setInViewport(true);
+    }
+
+    this->viewportWidgets = widgets;
+
+    // Rows scrolled out may be released.
+    emit viewportChanged();
+}
+
 void RundownTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
 {
     if (this->lock)
@@ -831,11 +1531,8 @@ void RundownTreeBaseWidget::mouseMoveEvent(QMouseEvent* event)
     if ((event->pos() - dragStartPosition).manhattanLength() < qApp->startDragDistance())
          return;
 
-    if (!copySelectedItems())
-        return;
-
     QMimeData* mimeData = new QMimeData();
-    mimeData->setData("application/rundown-item", qApp->clipboard()->text().toUtf8());
+    mimeData->setData("application/rundown-item", serializeSelectedItems().toUtf8());
 
     QDrag* drag = new QDrag(this);
     drag->setMimeData(mimeData);
@@ -881,6 +1578,8 @@ bool RundownTreeBaseWidget::dropMimeData(QTreeWidgetItem* parent, int index, con
         {
             QTreeWidget::setCurrentItem(parent);
 
+            beginInsert();
+
             QStringList dndDataSplit = dndData.split(";");
             foreach(QString data, dndDataSplit)
             {
@@ -889,6 +1588,8 @@ bool RundownTreeBaseWidget::dropMimeData(QTreeWidgetItem* parent, int index, con
                                                                                  dataSplit.at(4), dataSplit.at(5), dataSplit.at(6).toInt(),
                                                                                  dataSplit.at(7)));
             }
+
+            endInsert();
         }
         else if (dndData.startsWith("<treeWidgetPreset>")) // External drop from the preset library.
         {
@@ -907,7 +1608,7 @@ bool RundownTreeBaseWidget::dropMimeData(QTreeWidgetItem* parent, int index, con
 
             QTreeWidget::setCurrentItem(parent);
 
-            if (!pasteSelectedItems())
+            if (!pasteItems(dndData))
                 return false;
 
             selectItemBelow();
@@ -1024,6 +1725,8 @@ void RundownTreeBaseWidget::applyRepositoryChanges()
     // Get the current selected item story id.
     QString currentStoryId = currentItemStoryId();
 
+    beginInsert();
+
     int index = 0;
     while (index < this->repositoryChanges.count())
     {
@@ -1044,6 +1747,8 @@ void RundownTreeBaseWidget::applyRepositoryChanges()
         this->repositoryChanges.removeAt(index);
     }
 
+    endInsert();
+
     // Do we have updates which we can nott apply?
     if (this->repositoryChanges.count() > 0)
         checRepositoryChanges();
@@ -1069,24 +1774,51 @@ QString RundownTreeBaseWidget::currentItemStoryId()
     return currentStoryId;
 }
 
+void RundownTreeBaseWidget::indexStoryIds()
+{
+    foreach (QTreeWidgetItem* item, this->unindexedItems)
+    {
+        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
+        if (widget == NULL || widget->getCommand()->getStoryId().isEmpty())
+            continue;
+
+        this->storyItems.insert(widget->getCommand()->getStoryId(), item);
+        this->itemStories.insert(item, widget->getCommand()->getStoryId());
+    }
+
+    this->unindexedItems.clear();
+}
+
+void RundownTreeBaseWidget::unindexItem(QTreeWidgetItem* item)
+{
+    this->unindexedItems.remove(item);
+
+    if (this->itemStories.contains(item))
+        this->storyItems.remove(this->itemStories.take(item), item);
+}
+
 bool RundownTreeBaseWidget::containsStoryId(const QString& storyId, const QString& data)
 {
-    if (!data.isEmpty())
+    // Only the story id of each top-level item is read, nothing is built.
+    QXmlStreamReader reader(data);
+    if (!reader.readNextStartElement() || reader.name() != "items")
+        return false;
+
+    while (reader.readNextStartElement())
     {
-        std::wstringstream wstringstream;
-        wstringstream << data.toStdWString();
+        if (reader.name() != "item")
+        {
+            reader.skipCurrentElement();
 
-        boost::property_tree::wptree pt;
-        boost::property_tree::xml_parser::read_xml(wstringstream, pt);
+            continue;
+        }
 
-        BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
+        while (reader.readNextStartElement())
         {
-            if (parentValue.second.count(L"storyid") > 0)
-            {
-                QString storyid = QString::fromStdWString(parentValue.second.get(L"storyid", L""));
-                if (storyid == storyId)
-                    return true;
-            }
+            if (reader.name() == "storyid" && reader.readElementText() == storyId)
+                return true;
+            else if (reader.isStartElement())
+                reader.skipCurrentElement();
         }
     }
 
@@ -1108,92 +1840,49 @@ void RundownTreeBaseWidget::checRepositoryChanges()
 
 void RundownTreeBaseWidget::addRepositoryItem(const QString& storyId, const QString& data)
 {
-    int row = -1;
+    indexStoryIds();
 
-    for (int i = QTreeWidget::topLevelItemCount() - 1; i >= 0; i--)
-    {
-        QTreeWidgetItem* item = QTreeWidget::topLevelItem(i);
-        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->getCommand()->getStoryId() == storyId)
-        {
-            row = QTreeWidget::indexFromItem(item).row();
-            break; // We have found the last story id in the rundown.
-        }
-    }
-
-    int offset = 1;
-    std::wstringstream wstringstream;
-    wstringstream << data.toStdWString();
-
-    boost::property_tree::wptree pt;
-    boost::property_tree::xml_parser::read_xml(wstringstream, pt);
-
-    BOOST_FOREACH(boost::property_tree::wptree::value_type& parentValue, pt.get_child(L"items"))
-    {
-        if (parentValue.first != L"item")
-            continue;
-
-        AbstractRundownWidget* parentWidget = readProperties(parentValue.second);
-        parentWidget->setInGroup(false);
-        parentWidget->setExpanded(false);
-
-        QTreeWidgetItem* parentItem = new QTreeWidgetItem();
-
-        QTreeWidget::invisibleRootItem()->insertChild(row + offset++, parentItem);
-        QTreeWidget::setItemWidget(parentItem, 0, dynamic_cast<QWidget*>(parentWidget));
-
-        if (parentWidget->isGroup())
-        {
-            BOOST_FOREACH(boost::property_tree::wptree::value_type& childValue, parentValue.second.get_child(L"items"))
-            {
-                AbstractRundownWidget* childWidget = readProperties(childValue.second);
-                childWidget->setInGroup(true);
-
-                QTreeWidgetItem* childItem = new QTreeWidgetItem();
-                parentItem->addChild(childItem);
-
-                QTreeWidget::setItemWidget(childItem, 0, dynamic_cast<QWidget*>(childWidget));
-            }
-        }
+    // Insert below the last item of the story.
+    int row = -1;
+    foreach (QTreeWidgetItem* item, this->storyItems.values(storyId))
+        row = qMax(row, QTreeWidget::indexOfTopLevelItem(item));
 
-        QTreeWidget::doItemsLayout(); // Refresh
-        //QTreeWidget::repaint();
-    }
+    QXmlStreamReader reader(data);
+    insertItems(reader, QTreeWidget::invisibleRootItem(), row + 1);
 }
 
 void RundownTreeBaseWidget::removeRepositoryItem(const QString& storyId)
 {
-    for (int i = QTreeWidget::topLevelItemCount() - 1; i >= 0; i--)
+    indexStoryIds();
+
+    foreach (QTreeWidgetItem* item, this->storyItems.values(storyId))
     {
-        QTreeWidgetItem* item = QTreeWidget::topLevelItem(i);
         AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(QTreeWidget::itemWidget(item, 0));
-        if (widget->getCommand()->getStoryId() == storyId)
+
+        if (widget->isGroup())
         {
-            if (widget->isGroup())
+            for (int i = item->childCount() - 1; i >= 0; i--)
             {
-                for (int i = item->childCount() - 1; i >= 0; i--)
-                {
-                    QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
+                QWidget* childWidget = QTreeWidget::itemWidget(item->child(i), 0);
 
-                    // Remove our items from the AutoPlay queue if it exists.
-                    EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
+                // Remove our items from the AutoPlay queue if it exists.
+                EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item->child(i)));
 
-                    // Clear current playing item.
-                    EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
+                // Clear current playing item.
+                EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item->child(i)));
 
-                    delete childWidget;
-                    delete item->child(i);
-                }
+                delete childWidget;
+                delete item->child(i);
             }
+        }
 
-            // Remove our items from the auto play queue if it exists.
-            EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
+        // Remove our items from the auto play queue if it exists.
+        EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(item));
 
-            // Clear current playing item.
-            EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
+        // Clear current playing item.
+        EventManager::getInstance().fireClearCurrentPlayingItemEvent(ClearCurrentPlayingItemEvent(item));
 
-            delete widget;
-            delete item;
-        }
+        delete widget;
+        delete item;
     }
 }
@@ -14,9 +14,17 @@
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QHash>
+#include <QtCore/QList>
 #include <QtCore/QModelIndexList>
 #include <QtCore/QMimeData>
+#include <QtCore/QMultiHash>
+#include <QtCore/QPointer>
 #include <QtCore/QRect>
+#include <QtCore/QSet>
+#include <QtCore/QXmlStreamReader>
 #include <QtCore/QXmlStreamWriter>
 
 #include <QtGui/QDragEnterEvent>
@@ -29,12 +37,16 @@
 #include <QtWidgets/QTreeWidgetItem>
 #include <QtWidgets/QWidget>
 
+class RundownJournal;
+class RundownReader;
+
 class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
 {
     Q_OBJECT
 
     public:
         explicit RundownTreeBaseWidget(QWidget* parent = 0);
+        ~RundownTreeBaseWidget();
 
         bool getCompactView() const;
         void setCompactView(bool compactView);
@@ -46,6 +58,10 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         AbstractRundownWidget* readProperties(boost::property_tree::wptree& pt);
         void writeProperties(QTreeWidgetItem* item, QXmlStreamWriter* writer) const;
 
+        void loadItems(const QByteArray& data, bool repositoryRundown = false);
+        void cancelLoad();
+        bool isLoading() const;
+        bool pasteItems(const QString& data, bool repositoryRundown = false);
         bool pasteSelectedItems(bool repositoryRundown = false);
         bool pasteItemProperties();
         bool duplicateSelectedItems();
@@ -69,25 +85,91 @@ class WIDGETS_EXPORT RundownTreeBaseWidget : public QTreeWidget
         void addRepositoryChange(const RepositoryChangeModel& model);
         void setExpanded(bool expanded);
 
+        void beginInsert();
+        void endInsert();
+
+        void setJournal(RundownJournal* journal);
+        int getChangeCount() const;
+        void markItemChanged(QTreeWidgetItem* item);
+        void markRundownChanged();
+        void commitChanges();
+        void resetChanges();
+
+        void hibernateItems(const QSet<QTreeWidgetItem*>& liveItems);
+        void wakeItems();
+        void wakeItem(QTreeWidgetItem* item);
+        bool isHibernated() const;
+        void scheduleViewportUpdate();
+
+        Q_SIGNAL void loadFinished();
+        Q_SIGNAL void loadCancelled();
+        Q_SIGNAL void currentItemEdited();
+        Q_SIGNAL void viewportChanged();
+
         virtual bool dropMimeData(QTreeWidgetItem* parent, int index, const QMimeData* data, Qt::DropAction action);
 
     protected:
         void keyPressEvent(QKeyEvent* event);
         void mouseMoveEvent(QMouseEvent* event);
         void mousePressEvent(QMouseEvent* event);
+        void scrollContentsBy(int dx, int dy);
+        void updateGeometries();
+        void rowsInserted(const QModelIndex& parent, int start, int end);
+        void rowsAboutToBeRemoved(const QModelIndex& parent, int start, int end);
 
     private:
         bool compactView;
         QString theme;
         bool lock;
+        int insertDepth;
+        bool viewportUpdateScheduled;
+        QList<QPointer<QWidget>> viewportWidgets;
+        RundownReader* reader;
+        QElapsedTimer loadTimer;
+        qint64 loadConstructionTime;
+        RundownJournal* journal;
+        int changeCount;
+        quint64 nextItemId;
+        bool changesScheduled;
+        QList<quint64> journalItems;
+        QSet<quint64> changedItems;
+        QPointer<AbstractCommand> trackedCommand;
+        QMultiHash<QString, QTreeWidgetItem*> storyItems;
+        QHash<QTreeWidgetItem*, QString> itemStories;
+        QSet<QTreeWidgetItem*> unindexedItems;
+        QHash<QTreeWidgetItem*, QByteArray> hibernatedItems;
 
         QPoint dragStartPosition;
         QList<RepositoryChangeModel> repositoryChanges;
 
+        QString serializeSelectedItems() const;
+        bool insertItems(QXmlStreamReader& reader, QTreeWidgetItem* parentItem, int index);
+        bool insertItem(boost::property_tree::wptree& pt, QTreeWidgetItem* parentItem, int index);
+        void insertGroupItems(QTreeWidgetItem* parentItem, AbstractRundownWidget* parentWidget, boost::property_tree::wptree& pt);
+        void scheduleChanges();
+        void registerItem(QTreeWidgetItem* item);
+        void trackCurrentCommand();
+        quint64 getItemId(QTreeWidgetItem* item);
+        QByteArray serializeItem(QTreeWidgetItem* item) const;
+        QByteArray serializeWidget(QTreeWidgetItem* item) const;
+        void hibernateItem(QTreeWidgetItem* item);
+        void restoreItem(QTreeWidgetItem* item);
+        QList<QTreeWidgetItem*> getViewportItems(int margin) const;
+
         QString currentItemStoryId();
+        void indexStoryIds();
+        void unindexItem(QTreeWidgetItem* item);
         void removeRepositoryItem(const QString& storyId);
         bool containsStoryId(const QString& storyId, const QString& data);
         void addRepositoryItem(const QString& storyId, const QString& data);
 
         Q_SLOT void repositoryRundown(const RepositoryRundownEvent&);
+        Q_SLOT void updateViewport();
+        Q_SLOT void processLoadedItems();
+        Q_SLOT void allowRemoteTriggeringRead(bool);
+        Q_SLOT void processChanges();
+        Q_SLOT void currentItemModified();
+        Q_SLOT void trackCurrentItem(QTreeWidgetItem*, QTreeWidgetItem*);
+        Q_SLOT void itemExpandedChanged(QTreeWidgetItem*);
+        Q_SLOT void wakeSelectedItems();
 };
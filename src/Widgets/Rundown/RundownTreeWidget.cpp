@@ -28,6 +28,7 @@
 #include "PresetDialog.h"
 
 #include "GpiManager.h"
+#include "CommandScheduler.h"
 #include "DatabaseManager.h"
 #include "EventManager.h"
 #include "DeviceManager.h"
@@ -45,10 +46,9 @@
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
 #include <QtCore/QPoint>
-#include <QtCore/QTextCodec>
-#include <QtCore/QTime>
-#include <QtCore/QTextStream>
-#include <QtCore/QCryptographicHash>
+#include <QtCore/QSaveFile>
+#include <QtCore/QTimer>
+#include <QtCore/QtMath>
 
 #include <QtGui/QClipboard>
 #include <QtGui/QIcon>
@@ -61,8 +61,8 @@
 
 RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     : QWidget(parent),
-      active(false), enterPressed(false), allowRemoteRundownTriggering(false), repositoryRundown(false), previewOnAutoStep(false),
-      clearDelayedCommandsOnAutoStep(false), activeRundown(Rundown::DEFAULT_NAME), currentAutoPlayWidget(NULL), copyItem(NULL), currentPlayingItem(NULL), currentPlayingAutoStepItem(NULL),
+      active(false), enterPressed(false), navigating(false), selectionPending(false), allowRemoteRundownTriggering(false), repositoryRundown(false), previewOnAutoStep(false),
+      clearDelayedCommandsOnAutoStep(false), prerollItems(0), autoPlayPretriggerFrames(0), activeRundown(Rundown::DEFAULT_NAME), savedChangeCount(0), copyItem(NULL), currentPlayingItem(NULL), currentPlayingAutoStepItem(NULL),
       upControlSubscription(NULL), downControlSubscription(NULL), playAndAutoStepControlSubscription(NULL), playNowAndAutoStepControlSubscription(NULL),
       playNowIfChannelControlSubscription(NULL), stopControlSubscription(NULL), playControlSubscription(NULL), playNowControlSubscription(NULL),
       loadControlSubscription(NULL), pauseControlSubscription(NULL), nextControlSubscription(NULL), updateControlSubscription(NULL), invokeControlSubscription(NULL),
@@ -73,9 +73,33 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
 
     this->previewOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("PreviewOnAutoStep").getValue() == "true") ? true : false;
     this->clearDelayedCommandsOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("ClearDelayedCommandsOnAutoStep").getValue() == "true") ? true : false;
+    this->prerollItems = DatabaseManager::getInstance().getConfigurationByName("PrerollItems").getValue().toInt();
+    this->autoPlayPretriggerFrames = DatabaseManager::getInstance().getConfigurationByName("AutoPlayPretriggerFrames").getValue().toInt();
+    this->delayType = DatabaseManager::getInstance().getConfigurationByName("DelayType").getValue();
 
     QObject::connect(this->treeWidgetRundown, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(customContextMenuRequested(const QPoint &)));
 
+    this->treeWidgetRundown->installEventFilter(this);
+
+    this->treeWidgetRundown->setJournal(&this->journal);
+    QObject::connect(&this->journal, SIGNAL(compacted(bool, const QString&)), this, SLOT(journalCompacted(bool, const QString&)));
+    QObject::connect(this->treeWidgetRundown, SIGNAL(loadCancelled()), this, SLOT(loadCancelled()));
+    QObject::connect(this->treeWidgetRundown, SIGNAL(currentItemEdited()), this, SLOT(schedulePreroll()));
+
+    this->prerollTimer.setSingleShot(true);
+    this->prerollTimer.setInterval(Rundown::PREROLL_DELAY);
+    QObject::connect(&this->prerollTimer, SIGNAL(timeout()), this, SLOT(executePreroll()));
+
+    this->hibernateTimer.setSingleShot(true);
+    this->hibernateTimer.setInterval(Rundown::HIBERNATE_DELAY);
+    QObject::connect(&this->hibernateTimer, SIGNAL(timeout()), this, SLOT(hibernate()));
+
+    this->releaseTimer.setSingleShot(true);
+    this->releaseTimer.setInterval(Rundown::RELEASE_DELAY);
+    QObject::connect(&this->releaseTimer, SIGNAL(timeout()), this, SLOT(hibernate()));
+    QObject::connect(this->treeWidgetRundown, SIGNAL(viewportChanged()), this, SLOT(scheduleRelease()));
+    QObject::connect(this->treeWidgetRundown, SIGNAL(loadFinished()), this, SLOT(scheduleRelease()));
+
     // TODO: Specific Gpi device.
     QObject::connect(GpiManager::getInstance().getGpiDevice().data(), SIGNAL(gpiTriggered(int, GpiDevice*)), this, SLOT(gpiPortTriggered(int, GpiDevice*)));
 
@@ -86,7 +110,6 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(toggleCompactView(const CompactViewEvent&)), this, SLOT(toggleCompactView(const CompactViewEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(executeRundownItem(const ExecuteRundownItemEvent&)), this, SLOT(executeRundownItem(const ExecuteRundownItemEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(allowRemoteTriggering(const AllowRemoteTriggeringEvent&)), this, SLOT(allowRemoteTriggering(const AllowRemoteTriggeringEvent&)));
-    QObject::connect(&EventManager::getInstance(), SIGNAL(autoPlayRundownItem(const AutoPlayRundownItemEvent&)), this, SLOT(autoPlayRundownItem(const AutoPlayRundownItemEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(autoPlayChanged(const AutoPlayChangedEvent&)), this, SLOT(autoPlayChanged(const AutoPlayChangedEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent&)), this, SLOT(autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(executePlayoutCommand(const ExecutePlayoutCommandEvent&)), this, SLOT(executePlayoutCommand(const ExecutePlayoutCommandEvent&)));
@@ -96,6 +119,9 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     QObject::connect(&EventManager::getInstance(), SIGNAL(insertRepositoryChanges(const InsertRepositoryChangesEvent&)), this, SLOT(insertRepositoryChanges(const InsertRepositoryChangesEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(clearCurrentPlayingItem(const ClearCurrentPlayingItemEvent&)), this, SLOT(clearCurrentPlayingItem(const ClearCurrentPlayingItemEvent&)));
     QObject::connect(&EventManager::getInstance(), SIGNAL(currentItemChanged(const CurrentItemChangedEvent&)), this, SLOT(currentItemChanged(const CurrentItemChangedEvent&)));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(labelChanged(const LabelChangedEvent&)), this, SLOT(currentItemModified()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(targetChanged(const TargetChangedEvent&)), this, SLOT(currentItemModified()));
+    QObject::connect(&EventManager::getInstance(), SIGNAL(deviceChanged(const DeviceChangedEvent&)), this, SLOT(currentItemModified()));
 
     foreach (const GpiPortModel& port, DatabaseManager::getInstance().getGpiPorts())
         gpiBindingChanged(port.getPort(), port.getAction());
@@ -103,6 +129,13 @@ RundownTreeWidget::RundownTreeWidget(QWidget* parent)
     this->treeWidgetRundown->checkEmptyRundown();
 }
 
+RundownTreeWidget::~RundownTreeWidget()
+{
+    // The rundown is closed, unsaved edits were either saved or discarded.
+    this->treeWidgetRundown->setJournal(NULL);
+    this->journal.close();
+}
+
 void RundownTreeWidget::setupMenus()
 {
     this->contextMenuMixer = new QMenu(this);
@@ -374,8 +407,7 @@ void RundownTreeWidget::addPresetItem(const AddPresetItemEvent& event)
     if (!this->active)
         return;
 
-    qApp->clipboard()->setText(event.getPreset());
-    pasteSelectedItems();
+    this->treeWidgetRundown->pasteItems(event.getPreset(), this->repositoryRundown);
     selectItemBelow();
 }
 
@@ -394,16 +426,22 @@ void RundownTreeWidget::toggleCompactView(const CompactViewEvent& event)
         QTreeWidgetItem* item = this->treeWidgetRundown->invisibleRootItem()->child(i);
         QWidget* widget = dynamic_cast<QWidget*>(this->treeWidgetRundown->itemWidget(item, 0));
 
-        dynamic_cast<AbstractRundownWidget*>(widget)->setCompactView(!this->treeWidgetRundown->getCompactView());
-        if (this->treeWidgetRundown->getCompactView())
-            widget->setFixedHeight(Rundown::DEFAULT_ITEM_HEIGHT);
-        else
-            widget->setFixedHeight(Rundown::COMPACT_ITEM_HEIGHT);
+        // Released items are restored in the new view.
+        if (widget != NULL)
+        {
+            dynamic_cast<AbstractRundownWidget*>(widget)->setCompactView(!this->treeWidgetRundown->getCompactView());
+            if (this->treeWidgetRundown->getCompactView())
+                widget->setFixedHeight(Rundown::DEFAULT_ITEM_HEIGHT);
+            else
+                widget->setFixedHeight(Rundown::COMPACT_ITEM_HEIGHT);
+        }
 
         for (int j = 0; j < item->childCount(); j++)
         {
             QTreeWidgetItem* child = item->child(j);
             QWidget* widget = dynamic_cast<QWidget*>(this->treeWidgetRundown->itemWidget(child, 0));
+            if (widget == NULL)
+                continue;
 
             dynamic_cast<AbstractRundownWidget*>(widget)->setCompactView(!this->treeWidgetRundown->getCompactView());
             if (this->treeWidgetRundown->getCompactView())
@@ -413,9 +451,9 @@ void RundownTreeWidget::toggleCompactView(const CompactViewEvent& event)
         }
     }
 
-    this->treeWidgetRundown->doItemsLayout(); // Refresh
-
     this->treeWidgetRundown->setCompactView(!this->treeWidgetRundown->getCompactView());
+
+    this->treeWidgetRundown->doItemsLayout(); // Refresh
 }
 
 void RundownTreeWidget::executeRundownItem(const ExecuteRundownItemEvent& event)
@@ -434,7 +472,20 @@ void RundownTreeWidget::clearDelayedCommands()
         for (int i = 0; i < this->currentPlayingAutoStepItem->childCount(); i++)
         {
             QWidget* childWidget = this->treeWidgetRundown->itemWidget(this->currentPlayingAutoStepItem->child(i), 0);
-            dynamic_cast<AbstractRundownWidget*>(childWidget)->clearDelayedCommands();
+            if (childWidget != NULL)
+                dynamic_cast<AbstractRundownWidget*>(childWidget)->clearDelayedCommands();
+        }
+
+        // Cleared delays release the items, a pending duration still stops them later.
+        QList<QTreeWidgetItem*> items;
+        items.append(this->currentPlayingAutoStepItem);
+        for (int i = 0; i < this->currentPlayingAutoStepItem->childCount(); i++)
+            items.append(this->currentPlayingAutoStepItem->child(i));
+
+        foreach (QTreeWidgetItem* item, items)
+        {
+            if (this->delayedItems.contains(item) && getPendingTime(item, false) == 0)
+                this->delayedItems.remove(item);
         }
     }
 }
@@ -444,6 +495,13 @@ void RundownTreeWidget::allowRemoteTriggering(const AllowRemoteTriggeringEvent&
     if (!this->active)
         return;
 
+    // The value read while loading is already part of the rundown.
+    if (event.getEnabled() != this->allowRemoteRundownTriggering && !this->treeWidgetRundown->isLoading())
+    {
+        this->journal.setAllowRemoteTriggering(event.getEnabled());
+        this->treeWidgetRundown->markRundownChanged();
+    }
+
     this->allowRemoteRundownTriggering = event.getEnabled();
 
     (this->allowRemoteRundownTriggering == true) ? configureOscSubscriptions() : resetOscSubscriptions();
@@ -460,6 +518,8 @@ void RundownTreeWidget::addRudnownItem(const AddRudnownItemEvent& event)
 
     widget->setCompactView(this->treeWidgetRundown->getCompactView());
 
+    this->treeWidgetRundown->beginInsert();
+
     QTreeWidgetItem* item = new QTreeWidgetItem();
     if (this->treeWidgetRundown->currentItem() == NULL) // There is no item selected.
         this->treeWidgetRundown->invisibleRootItem()->addChild(item); // Add item to the bottom of the rundown.
@@ -480,10 +540,7 @@ void RundownTreeWidget::addRudnownItem(const AddRudnownItemEvent& event)
     else
         dynamic_cast<QWidget*>(widget)->setFixedHeight(Rundown::DEFAULT_ITEM_HEIGHT);
 
-    this->treeWidgetRundown->doItemsLayout(); // Refresh.
-    this->treeWidgetRundown->repaint();
-
-    this->treeWidgetRundown->checkEmptyRundown();
+    this->treeWidgetRundown->endInsert();
 }
 
 void RundownTreeWidget::autoPlayChanged(const AutoPlayChangedEvent& event)
@@ -501,64 +558,230 @@ void RundownTreeWidget::autoPlayChanged(const AutoPlayChangedEvent& event)
     }
 }
 
-void RundownTreeWidget::autoPlayRundownItem(const AutoPlayRundownItemEvent& event)
+void RundownTreeWidget::autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent& event)
 {
     if (!this->active)
         return;
 
     AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(event.getSource());
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
+
+    foreach (RundownAutoPlayQueue* autoPlayQueue, this->autoPlayQueues)
     {
         if (autoPlayQueue->contains(rundownWidget))
         {
-            // Remove currently playing item.
-            autoPlayQueue->removeAt(0);
-
-            // Have more in queue, play them...
-            if (!autoPlayQueue->isEmpty())
-            {
-                AbstractRundownWidget* rundownQueueWidget = dynamic_cast<AbstractRundownWidget*>(autoPlayQueue->at(0));
-                dynamic_cast<AbstractPlayoutCommand*>(rundownQueueWidget)->executeCommand(Playout::PlayoutType::Play);
-
-                this->currentAutoPlayWidget = rundownQueueWidget;
-            }
-            else
-                this->autoPlayQueues.removeOne(autoPlayQueue);
+            // Skip to the next item in queue.
+            autoPlayQueue->next();
 
             break;
         }
     }
 }
 
-void RundownTreeWidget::autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent& event)
+RundownAutoPlayQueue* RundownTreeWidget::createAutoPlayQueue()
+{
+    RundownAutoPlayQueue* autoPlayQueue = new RundownAutoPlayQueue(this->autoPlayPretriggerFrames, this);
+    QObject::connect(autoPlayQueue, SIGNAL(finished()), this, SLOT(autoPlayQueueFinished()));
+
+    return autoPlayQueue;
+}
+
+void RundownTreeWidget::clearAutoPlayQueues()
 {
+    qDeleteAll(this->autoPlayQueues);
+    this->autoPlayQueues.clear();
+}
+
+void RundownTreeWidget::autoPlayQueueFinished()
+{
+    RundownAutoPlayQueue* autoPlayQueue = qobject_cast<RundownAutoPlayQueue*>(QObject::sender());
+    if (autoPlayQueue == NULL)
+        return;
+
+    // The queue owns no items, it is released once it has worked through them.
+    this->autoPlayQueues.removeOne(autoPlayQueue);
+    autoPlayQueue->deleteLater();
+
+    // Its items may be released now.
     if (!this->active)
+        this->hibernateTimer.start();
+}
+
+void RundownTreeWidget::trackDelayedItem(QTreeWidgetItem* item)
+{
+    // Commands still waiting for their delay or duration keep the item live until they are due.
+    qint64 pendingTime = getPendingTime(item, true);
+    if (pendingTime == 0)
         return;
 
-    AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(event.getSource());
+    qint64 deadline = CommandScheduler::getInstance().getTime() + pendingTime;
+    if (deadline > this->delayedItems.value(item, 0))
+    {
+        this->delayedItems.insert(item, deadline);
+        QTimer::singleShot(int(pendingTime), Qt::PreciseTimer, this, SLOT(releaseDelayedItems()));
+    }
+}
+
+qint64 RundownTreeWidget::getPendingTime(QTreeWidgetItem* item, bool includeDelay) const
+{
+    QTreeWidgetItem* groupItem = (item->parent() != NULL) ? item->parent() : item;
+
+    QList<QTreeWidgetItem*> items;
+    items.append(groupItem);
+    for (int i = 0; i < groupItem->childCount(); i++)
+        items.append(groupItem->child(i));
 
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
+    qint64 pendingTime = 0;
+    foreach (QTreeWidgetItem* delayedItem, items)
     {
-        if (autoPlayQueue->contains(rundownWidget))
+        AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(delayedItem, 0));
+        if (widget == NULL || widget->getCommand()->getDelay() < 0)
+            continue;
+
+        int duration = qMax(widget->getCommand()->getDuration(), 0);
+        int delay = widget->getCommand()->getDelay();
+        if (!includeDelay && duration == 0)
+            continue;
+
+        int time = delay + duration;
+        if (time == 0)
+            continue;
+
+        if (this->delayType == Output::DEFAULT_DELAY_IN_FRAMES)
         {
-            // Have more in queue, play them...
-            if (!autoPlayQueue->isEmpty())
-            {
-                AbstractRundownWidget* rundownQueueWidget = dynamic_cast<AbstractRundownWidget*>(autoPlayQueue->at(0));
-                dynamic_cast<AbstractPlayoutCommand*>(rundownQueueWidget)->executeCommand(Playout::PlayoutType::Next);
+            // Widgets whose channel has no format schedule nothing.
+            double framesPerSecond = DeviceManager::getInstance().getFramesPerSecond(widget->getLibraryModel()->getDeviceName(), widget->getCommand()->getChannel());
+            if (framesPerSecond <= 0)
+                continue;
 
-                this->currentAutoPlayWidget = rundownQueueWidget;
-            }
+            // One frame more, deadlines are aligned to the frame clock.
+            pendingTime = qMax(pendingTime, qint64(qCeil((time + 1) * 1000 / framesPerSecond)));
+        }
+        else if (this->delayType == Output::DEFAULT_DELAY_IN_MILLISECONDS)
+            pendingTime = qMax(pendingTime, qint64(time));
+    }
 
-            break;
+    return pendingTime;
+}
+
+void RundownTreeWidget::releaseDelayedItems()
+{
+    qint64 time = CommandScheduler::getInstance().getTime();
+
+    bool released = false;
+    QMutableHashIterator<QTreeWidgetItem*, qint64> iterator(this->delayedItems);
+    while (iterator.hasNext())
+    {
+        iterator.next();
+        if (iterator.value() <= time)
+        {
+            iterator.remove();
+            released = true;
+        }
+    }
+
+    // Its items may be released now.
+    if (released && !this->active && !this->hibernateTimer.isActive())
+        this->hibernateTimer.start();
+}
+
+QSet<QTreeWidgetItem*> RundownTreeWidget::getLiveItems() const
+{
+    QSet<QTreeWidgetItem*> items;
+    items.insert(this->treeWidgetRundown->currentItem());
+    items.insert(this->currentPlayingItem);
+    items.insert(this->currentPlayingAutoStepItem);
+    foreach (QTreeWidgetItem* item, this->delayedItems.keys())
+        items.insert(item);
+
+    // Pre-rolled items keep their loaded background until they are played.
+    QSet<QWidget*> prerolledWidgets;
+    foreach (const QPointer<QWidget>& widget, this->prerolledLayers)
+        prerolledWidgets.insert(widget.data());
+
+    QTreeWidgetItem* rootItem = this->treeWidgetRundown->invisibleRootItem();
+    for (int i = 0; i < rootItem->childCount(); i++)
+    {
+        QList<QTreeWidgetItem*> groupItems;
+        groupItems.append(rootItem->child(i));
+        for (int j = 0; j < rootItem->child(i)->childCount(); j++)
+            groupItems.append(rootItem->child(i)->child(j));
+
+        foreach (QTreeWidgetItem* item, groupItems)
+        {
+            AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(item, 0));
+            if (widget == NULL)
+                continue;
+
+            bool queued = false;
+            foreach (RundownAutoPlayQueue* autoPlayQueue, this->autoPlayQueues)
+                queued = queued || autoPlayQueue->contains(widget);
+
+            // On air, queued, pre-rolled or listening for remote triggers.
+            if (queued || widget->isLive() || widget->getCommand()->getAllowRemoteTriggering() || prerolledWidgets.contains(dynamic_cast<QWidget*>(widget)))
+                items.insert(item);
         }
     }
+
+    items.remove(NULL);
+
+    // A group is kept live along with all of its items.
+    QSet<QTreeWidgetItem*> liveItems;
+    foreach (QTreeWidgetItem* item, items)
+    {
+        QTreeWidgetItem* groupItem = (item->parent() != NULL) ? item->parent() : item;
+
+        liveItems.insert(groupItem);
+        for (int i = 0; i < groupItem->childCount(); i++)
+            liveItems.insert(groupItem->child(i));
+    }
+
+    return liveItems;
+}
+
+void RundownTreeWidget::hibernate()
+{
+    // Repository rundowns apply their changes to the widgets as they come in.
+    if (this->repositoryRundown)
+        return;
+
+    // Retried until the rest of the rundown has been read, the active rundown once loading has finished.
+    if (this->treeWidgetRundown->isLoading())
+    {
+        if (!this->active)
+            this->hibernateTimer.start();
+
+        return;
+    }
+
+    // Rows on screen and the selection are kept by the rundown itself.
+    this->treeWidgetRundown->hibernateItems(getLiveItems());
+}
+
+void RundownTreeWidget::scheduleRelease()
+{
+    // The active rundown releases the widgets of rows scrolled out of view once scrolling has settled,
+    // inactive rundowns release theirs after the grace period of hibernateTimer.
+    if (this->active)
+        this->releaseTimer.start();
 }
 
 void RundownTreeWidget::setActive(bool active)
 {
     this->active = active;
 
+    // Inactive rundowns release the widgets of items not on air after a grace period, tabs
+    // flipped through quickly are left alone. The active rundown only restores the rows on screen.
+    if (this->active)
+    {
+        this->hibernateTimer.stop();
+        this->treeWidgetRundown->scheduleViewportUpdate();
+    }
+    else
+    {
+        this->releaseTimer.stop();
+        this->hibernateTimer.start();
+    }
+
     if (this->active)
     {
         EventManager::getInstance().fireAllowRemoteTriggeringEvent(AllowRemoteTriggeringEvent(this->allowRemoteRundownTriggering));
@@ -567,26 +790,18 @@ void RundownTreeWidget::setActive(bool active)
 
     EventManager::getInstance().fireActiveRundownChangedEvent(ActiveRundownChangedEvent(this->activeRundown));
 
+    // Only the active rundown keeps its upcoming items loaded.
+    schedulePreroll();
+
     QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
     QWidget* currentItemWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
 
-    QTreeWidgetItem* currentItemParent = NULL;
-    if (currentItem != NULL)
-        currentItemParent = this->treeWidgetRundown->currentItem()->parent();
-
-    QWidget* currentItemWidgetParent = NULL;
-    if (currentItemParent != NULL)
-        currentItemWidgetParent = this->treeWidgetRundown->itemWidget(currentItemParent, 0);
-
     if (currentItem != NULL && currentItemWidget != NULL)
     {
         dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->setActive(this->active);
         dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->setSelected(this->active);
 
-        AbstractCommand* command = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getCommand();
-        LibraryModel* model = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getLibraryModel();
-
-        EventManager::getInstance().fireRundownItemSelectedEvent(RundownItemSelectedEvent(command, model, currentItemWidget, currentItemWidgetParent));
+        fireItemSelected();
         EventManager::getInstance().fireSaveAsPresetMenuEvent(SaveAsPresetMenuEvent(true));
     }
     else // Empty rundown.
@@ -598,49 +813,39 @@ void RundownTreeWidget::setActive(bool active)
 
 void RundownTreeWidget::openRundown(const QString& path)
 {
-    QTime time;
-    time.start();
-
     EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Opening rundown..."));
 
     qDebug("Open rundown %s", qPrintable(path));
 
     QFile file(path);
-    if (file.open(QFile::ReadOnly | QIODevice::Text))
+    if (!file.open(QFile::ReadOnly | QIODevice::Text))
     {
-        this->activeRundown = path;
-
-        QTextStream stream(&file);
-        stream.setCodec(QTextCodec::codecForName("UTF-8"));
-
-        // Save the latest value stored in the clipboard.
-        QString latest = qApp->clipboard()->text();
-        QString data = stream.readAll();
-
-        this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
-        qDebug("Hash is %s", qPrintable(this->hexHash));
-
-        qApp->clipboard()->setText(data);
-        pasteSelectedItems();
-
-        // Set previous stored clipboard value.
-        qApp->clipboard()->setText(latest);
+        EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
+        return;
+    }
 
-        qDebug("Parsing rundown completed in %d msec", time.elapsed());
+    this->activeRundown = path;
 
-        file.close();
+    QByteArray data = file.readAll();
+    file.close();
 
-        if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
-            this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
+    // A journal which isn't ours was left behind by a crash, its edits are loaded but not saved yet.
+    QByteArray document = data;
+    bool recovered = (this->journal.getPath() != path && RundownJournal::recover(path, document));
+    if (recovered)
+        qWarning("Recovered unsaved changes to rundown %s", qPrintable(path));
 
-        this->treeWidgetRundown->setFocus();
+    this->journal.open(path, data);
+    discardCompactions();
 
-        DatabaseManager::getInstance().insertOpenRecent(path);
+    this->treeWidgetRundown->resetChanges();
+    this->savedChangeCount = (recovered == true) ? -1 : 0;
 
-        qDebug("RundownTreeWidget::openRundown %d msec (%d items)", time.elapsed(), this->treeWidgetRundown->invisibleRootItem()->childCount());
-    }
+    // Items are streamed into the rundown as they are parsed, press escape to cancel.
+    this->treeWidgetRundown->loadItems(document, this->repositoryRundown);
+    this->treeWidgetRundown->setFocus();
 
-    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
+    DatabaseManager::getInstance().insertOpenRecent(path);
 }
 
 void RundownTreeWidget::openRundownFromUrl(const QString& url)
@@ -666,28 +871,17 @@ void RundownTreeWidget::doOpenRundownFromUrl(QNetworkReply* reply)
 {
     this->repositoryRundown = true;
 
-    // Save the latest value stored in the clipboard.
-    QString latest = qApp->clipboard()->text();
-    QString data = QString::fromUtf8(reply->readAll());
-
-    this->hexHash = QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
-    qDebug("Hash is %s", qPrintable(this->hexHash));
+    QByteArray data = reply->readAll();
 
-    qApp->clipboard()->setText(data);
-    pasteSelectedItems();
-
-    // Set previous stored clipboard value.
-    qApp->clipboard()->setText(latest);
-
-    if (this->treeWidgetRundown->invisibleRootItem()->childCount() > 0)
-        this->treeWidgetRundown->setCurrentItem(this->treeWidgetRundown->invisibleRootItem()->child(0));
+    this->treeWidgetRundown->resetChanges();
+    this->savedChangeCount = 0;
 
+    this->treeWidgetRundown->loadItems(data, this->repositoryRundown);
     this->treeWidgetRundown->setFocus();
 
     EventManager::getInstance().fireSaveMenuEvent(SaveMenuEvent(false));
     EventManager::getInstance().fireSaveAsMenuEvent(SaveAsMenuEvent(false));
     EventManager::getInstance().fireReloadRundownMenuEvent(ReloadRundownMenuEvent(true));
-    EventManager::getInstance().fireStatusbarEvent(StatusbarEvent(""));
 
     reply->deleteLater();
     this->networkManager->deleteLater();
@@ -737,11 +931,9 @@ void RundownTreeWidget::reloadRundown()
     if (this->currentPlayingAutoStepItem != NULL)
         this->currentPlayingAutoStepItem = NULL;
 
-    if (this->currentAutoPlayWidget != NULL)
-    {
-        delete this->currentAutoPlayWidget;
-        this->currentAutoPlayWidget = NULL;
-    }
+    this->delayedItems.clear();
+
+    clearAutoPlayQueues();
 
     this->treeWidgetRundown->removeAllItems();
 
@@ -759,6 +951,10 @@ void RundownTreeWidget::saveRundown(bool saveAs)
     if (this->treeWidgetRundown->invisibleRootItem()->childCount() == 0)
         return;
 
+    // Don't write a partially loaded rundown.
+    if (this->treeWidgetRundown->isLoading())
+        return;
+
     QString path;
     if (saveAs)
         path = QFileDialog::getSaveFileName(this, "Save Rundown", QDir::homePath(), "Rundown (*.xml)");
@@ -773,12 +969,20 @@ void RundownTreeWidget::saveRundown(bool saveAs)
     {
         EventManager::getInstance().fireStatusbarEvent(StatusbarEvent("Saving rundown..."));
 
-        QFile file(path);
-        if (file.exists())
-            file.remove();
+        if (path == this->journal.getPath() && this->journal.isOpen())
+        {
+            // Every edit is in the journal already, it's compacted into the rundown in the background.
+            // The rundown is only saved once the compaction has been written.
+            this->treeWidgetRundown->commitChanges();
+            this->journal.compact();
 
-        if (file.open(QFile::WriteOnly))
+            this->compactChangeCounts.append(this->treeWidgetRundown->getChangeCount());
+        }
+        else
         {
+            // Every item is written from its widget.
+            this->treeWidgetRundown->wakeItems();
+
             QByteArray data;
             QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
 
@@ -792,13 +996,23 @@ void RundownTreeWidget::saveRundown(bool saveAs)
             writer->writeEndElement();
             writer->writeEndDocument();
 
-            this->hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
-            qDebug("Hash is %s", qPrintable(this->hexHash));
+            // Written to a temporary file and renamed, a failed save leaves the previous rundown intact.
+            QSaveFile file(path);
+            if (file.open(QFile::WriteOnly) && file.write(data) == data.size() && file.commit())
+            {
+                this->journal.open(path, data);
+                discardCompactions();
 
-            file.write(data);
-            file.close();
+                this->treeWidgetRundown->resetChanges();
+                this->savedChangeCount = 0;
 
-            qDebug("Saved rundown to %s", qPrintable(path));
+                qDebug("Saved rundown to %s", qPrintable(path));
+            }
+            else
+                qWarning("Unable to save rundown to %s: %s", qPrintable(path), qPrintable(file.errorString()));
+
+            if (!this->active)
+                this->hibernateTimer.start();
         }
 
         this->activeRundown = path;
@@ -807,6 +1021,46 @@ void RundownTreeWidget::saveRundown(bool saveAs)
     }
 }
 
+void RundownTreeWidget::loadCancelled()
+{
+    qWarning("Loading rundown %s was cancelled, it's detached from the file", qPrintable(this->activeRundown));
+
+    // The items not loaded would be lost if the partial rundown was saved over its file.
+    this->journal.close();
+    discardCompactions();
+
+    this->savedChangeCount = -1;
+
+    this->activeRundown = Rundown::DEFAULT_NAME;
+    EventManager::getInstance().fireActiveRundownChangedEvent(ActiveRundownChangedEvent(this->activeRundown));
+}
+
+void RundownTreeWidget::discardCompactions()
+{
+    // Compactions still pending report against a journal which has been replaced.
+    for (int i = 0; i < this->compactChangeCounts.count(); i++)
+        this->compactChangeCounts[i] = -1;
+}
+
+void RundownTreeWidget::journalCompacted(bool success, const QString& error)
+{
+    if (this->compactChangeCounts.isEmpty())
+        return;
+
+    int changeCount = this->compactChangeCounts.takeFirst();
+    if (changeCount < 0)
+        return; // Superseded by a full save or reopen.
+
+    if (success)
+    {
+        this->savedChangeCount = changeCount;
+
+        qDebug("Saved rundown to %s", qPrintable(this->journal.getPath()));
+    }
+    else
+        qWarning("Unable to save rundown to %s: %s", qPrintable(this->journal.getPath()), qPrintable(error));
+}
+
 bool RundownTreeWidget::checkForSave() const
 {
     // Don't save empty rundowns.
@@ -817,26 +1071,14 @@ bool RundownTreeWidget::checkForSave() const
     if (this->repositoryRundown)
         return false;
 
-    QByteArray data;
-    QXmlStreamWriter* writer = new QXmlStreamWriter(&data);
-
-    writer->writeStartDocument();
-    writer->writeStartElement("items");
-    writer->writeTextElement("allowremotetriggering", (this->allowRemoteRundownTriggering == true) ? "true" : "false");
-
-    for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
-        this->treeWidgetRundown->writeProperties(this->treeWidgetRundown->invisibleRootItem()->child(i), writer);
-
-    writer->writeEndElement();
-    writer->writeEndDocument();
-
-    QString hexHash = QString(QCryptographicHash::hash(data, QCryptographicHash::Md5).toHex());
-    qDebug("Hash is %s", qPrintable(hexHash));
+    // A rundown which is still loading is cancelled, never saved.
+    if (this->treeWidgetRundown->isLoading())
+        return false;
 
-    if (hexHash != this->hexHash)
-        return true;
+    // Edits are counted as they are made, nothing is serialized here.
+    this->treeWidgetRundown->commitChanges();
 
-    return false;
+    return this->treeWidgetRundown->getChangeCount() != this->savedChangeCount;
 }
 
 void RundownTreeWidget::colorizeItems(const QString& color)
@@ -845,7 +1087,10 @@ void RundownTreeWidget::colorizeItems(const QString& color)
         return;
 
     foreach (QTreeWidgetItem* item, this->treeWidgetRundown->selectedItems())
+    {
         dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(item, 0))->setColor(color); // Colorize current selected item.
+        this->treeWidgetRundown->markItemChanged(item);
+    }
 }
 
 void RundownTreeWidget::gpiPortTriggered(int gpiPort, GpiDevice* device)
@@ -1031,27 +1276,21 @@ void RundownTreeWidget::itemClicked(QTreeWidgetItem* current, int index)
     if (this->treeWidgetRundown->currentItem() == NULL)
         return;
 
-    QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
-    QWidget* currentItemWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
-
-    QTreeWidgetItem* currentItemParent = NULL;
-    if (currentItem != NULL)
-        currentItemParent = this->treeWidgetRundown->currentItem()->parent();
-
-    QWidget* currentItemWidgetParent = NULL;
-    if (currentItemParent != NULL)
-        currentItemWidgetParent = this->treeWidgetRundown->itemWidget(currentItemParent, 0);
-
-    if (currentItem != NULL && currentItemWidget != NULL)
+    if (this->treeWidgetRundown->itemWidget(this->treeWidgetRundown->currentItem(), 0) != NULL)
     {
-        AbstractCommand* command = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getCommand();
-        LibraryModel* model = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getLibraryModel();
-
-        EventManager::getInstance().fireRundownItemSelectedEvent(RundownItemSelectedEvent(command, model, currentItemWidget, currentItemWidgetParent));
+        fireItemSelected();
         EventManager::getInstance().fireSaveAsPresetMenuEvent(SaveAsPresetMenuEvent(true));
     }
 }
 
+void RundownTreeWidget::currentItemModified()
+{
+    if (!this->active)
+        return;
+
+    this->treeWidgetRundown->markItemChanged(this->treeWidgetRundown->currentItem());
+}
+
 void RundownTreeWidget::currentItemChanged(QTreeWidgetItem* current, QTreeWidgetItem* previous)
 {
     QWidget* currentWidget = this->treeWidgetRundown->itemWidget(current, 0);
@@ -1076,27 +1315,86 @@ void RundownTreeWidget::currentItemChanged(QTreeWidgetItem* current, QTreeWidget
     QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
     QWidget* currentItemWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
 
-    QTreeWidgetItem* currentItemParent = NULL;
-    if (currentItem != NULL)
-        currentItemParent = this->treeWidgetRundown->currentItem()->parent();
-
-    QWidget* currentItemWidgetParent = NULL;
-    if (currentItemParent != NULL)
-        currentItemWidgetParent = this->treeWidgetRundown->itemWidget(currentItemParent, 0);
-
     if (currentItem != NULL && currentItemWidget != NULL)
     {
-        AbstractCommand* command = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getCommand();
-        LibraryModel* model = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getLibraryModel();
-
-        EventManager::getInstance().fireRundownItemSelectedEvent(RundownItemSelectedEvent(command, model, currentItemWidget, currentItemWidgetParent));
         EventManager::getInstance().fireSaveAsPresetMenuEvent(SaveAsPresetMenuEvent(true));
+
+        // While a navigation key is held down only the highlight follows, the inspector, preview and preroll
+        // catch up with the last selected item when the key is released.
+        if (this->navigating)
+        {
+            this->selectionPending = true;
+            return;
+        }
+
+        fireItemSelected();
     }
     else if (currentItem == NULL && previous != NULL && this->treeWidgetRundown->invisibleRootItem()->childCount() == 1) // Last item was removed form the rundown.
     {
+        this->selectionPending = false;
+
         EventManager::getInstance().fireEmptyRundownEvent(EmptyRundownEvent());
         EventManager::getInstance().fireSaveAsPresetMenuEvent(SaveAsPresetMenuEvent(false));
     }
+
+    schedulePreroll();
+}
+
+void RundownTreeWidget::fireItemSelected()
+{
+    this->selectionPending = false;
+
+    QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
+    QWidget* currentItemWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
+    if (currentItem == NULL || currentItemWidget == NULL)
+        return;
+
+    QWidget* currentItemWidgetParent = NULL;
+    if (currentItem->parent() != NULL)
+        currentItemWidgetParent = this->treeWidgetRundown->itemWidget(currentItem->parent(), 0);
+
+    AbstractCommand* command = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getCommand();
+    LibraryModel* model = dynamic_cast<AbstractRundownWidget*>(currentItemWidget)->getLibraryModel();
+
+    EventManager::getInstance().fireRundownItemSelectedEvent(RundownItemSelectedEvent(command, model, currentItemWidget, currentItemWidgetParent));
+}
+
+void RundownTreeWidget::settleNavigation()
+{
+    this->navigating = false;
+
+    if (!this->selectionPending)
+        return;
+
+    fireItemSelected();
+    schedulePreroll();
+}
+
+bool RundownTreeWidget::eventFilter(QObject* target, QEvent* event)
+{
+    if (target == this->treeWidgetRundown)
+    {
+        if (event->type() == QEvent::KeyPress || event->type() == QEvent::KeyRelease)
+        {
+            QKeyEvent* keyEvent = static_cast<QKeyEvent*>(event);
+            if ((keyEvent->modifiers() == Qt::NoModifier || keyEvent->modifiers() == Qt::KeypadModifier) &&
+                (keyEvent->key() == Qt::Key_Up || keyEvent->key() == Qt::Key_Down || keyEvent->key() == Qt::Key_PageUp ||
+                 keyEvent->key() == Qt::Key_PageDown || keyEvent->key() == Qt::Key_Home || keyEvent->key() == Qt::Key_End))
+            {
+                // The first press is handled right away, repeats are coalesced until the key is released.
+                if (event->type() == QEvent::KeyPress)
+                    this->navigating = keyEvent->isAutoRepeat();
+                else if (!keyEvent->isAutoRepeat())
+                    settleNavigation();
+            }
+        }
+        else if (event->type() == QEvent::FocusOut)
+        {
+            settleNavigation();
+        }
+    }
+
+    return QWidget::eventFilter(target, event);
 }
 
 void RundownTreeWidget::itemDoubleClicked(QTreeWidgetItem* item, int index)
@@ -1147,6 +1445,9 @@ void RundownTreeWidget::setUsed(bool used)
 
 void RundownTreeWidget::setAllUsed(bool used)
 {
+    // Released items keep the used state they were serialized with, they are marked through their widgets.
+    this->treeWidgetRundown->wakeItems();
+
     for (int i = 0; i < this->treeWidgetRundown->invisibleRootItem()->childCount(); i++)
     {
         QTreeWidgetItem* currentItem = this->treeWidgetRundown->invisibleRootItem()->child(i);
@@ -1184,6 +1485,8 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
         currentItem = this->treeWidgetRundown->currentItem();
         //currentIndex = this->treeWidgetRundown->currentIndex();
 
+        this->treeWidgetRundown->wakeItem(currentItem);
+
         selectedWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
         selectedWidgetParent = this->treeWidgetRundown->itemWidget(currentItem->parent(), 0);
 
@@ -1195,6 +1498,8 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
         currentItem = item;
         //currentIndex = this->treeWidgetRundown->indexOfTopLevelItem(item);
 
+        this->treeWidgetRundown->wakeItem(currentItem);
+
         selectedWidget = this->treeWidgetRundown->itemWidget(currentItem, 0);
         selectedWidgetParent = this->treeWidgetRundown->itemWidget(currentItem->parent(), 0);
 
@@ -1205,9 +1510,13 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
     if (source == Action::ActionType::GpiPulse && !rundownWidget->getCommand()->getAllowGpi())
         return true; // Gpi pulses cannot trigger this item.
 
+    updatePrerolledLayers(type, currentItem);
+    trackDelayedItem(currentItem);
+
     if (type == Playout::PlayoutType::Next && rundownWidgetParent != nullptr && rundownWidgetParent->isGroup() && dynamic_cast<GroupCommand*>(rundownWidgetParent->getCommand())->getAutoPlay())
     {
-        EventManager::getInstance().fireAutoPlayNextRundownItemEvent(AutoPlayNextRundownItemEvent(dynamic_cast<QWidget*>(this->currentAutoPlayWidget)));
+        if (!this->currentAutoPlayQueue.isNull() && this->currentAutoPlayQueue->getCurrentWidget() != nullptr)
+            EventManager::getInstance().fireAutoPlayNextRundownItemEvent(AutoPlayNextRundownItemEvent(dynamic_cast<QWidget*>(this->currentAutoPlayQueue->getCurrentWidget())));
 
         return true;
     }
@@ -1226,20 +1535,20 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
     {
         if (type == Playout::PlayoutType::Next && dynamic_cast<GroupCommand*>(rundownWidget->getCommand())->getAutoPlay())
         {
-            if (this->currentAutoPlayWidget != nullptr)
-                EventManager::getInstance().fireAutoPlayNextRundownItemEvent(AutoPlayNextRundownItemEvent(dynamic_cast<QWidget*>(this->currentAutoPlayWidget)));
+            if (!this->currentAutoPlayQueue.isNull() && this->currentAutoPlayQueue->getCurrentWidget() != nullptr)
+                EventManager::getInstance().fireAutoPlayNextRundownItemEvent(AutoPlayNextRundownItemEvent(dynamic_cast<QWidget*>(this->currentAutoPlayQueue->getCurrentWidget())));
         }
         else if (type == Playout::PlayoutType::PauseResume && dynamic_cast<GroupCommand*>(rundownWidget->getCommand())->getAutoPlay())
         {
-            if (this->currentAutoPlayWidget != nullptr)
-                dynamic_cast<AbstractPlayoutCommand*>(this->currentAutoPlayWidget)->executeCommand(type);
+            if (!this->currentAutoPlayQueue.isNull() && this->currentAutoPlayQueue->getCurrentWidget() != nullptr)
+                dynamic_cast<AbstractPlayoutCommand*>(this->currentAutoPlayQueue->getCurrentWidget())->executeCommand(type);
         }
         else if ((type == Playout::PlayoutType::Play || type == Playout::PlayoutType::Load) && dynamic_cast<GroupCommand*>(rundownWidget->getCommand())->getAutoPlay())
         {
             // The group have AutoPlay enabled, play the items within the group.
             bool isFirstChild = true;
 
-            QList<AbstractRundownWidget*>* autoPlayQueue = new QList<AbstractRundownWidget*>();
+            RundownAutoPlayQueue* autoPlayQueue = createAutoPlayQueue();
             for (int i = 0; i < currentItem->childCount(); i++)
             {
                 QWidget* childWidget = this->treeWidgetRundown->itemWidget(currentItem->child(i), 0);
@@ -1250,17 +1559,18 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                     if (!dynamic_cast<MovieCommand*>(rundownChildWidget->getCommand())->getAutoPlay())
                         continue;
 
+                    // Taken over from a queue still working through the group.
+                    EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(currentItem->child(i)));
+
                     // Only execute the first child in the group, add the rest to the AutoPlay queue.
                     if (isFirstChild)
                     {
                         dynamic_cast<AbstractPlayoutCommand*>(rundownChildWidget)->executeCommand(type);
                         if (type == Playout::PlayoutType::Load)
                             break; // We only want  to load the first item.
-
-                        this->currentAutoPlayWidget = rundownChildWidget;
                     }
 
-                    autoPlayQueue->push_back(rundownChildWidget); // Add our widget to the execution queue.
+                    autoPlayQueue->append(rundownChildWidget); // Add our widget to the execution queue.
 
                     isFirstChild = false;
                 }
@@ -1270,8 +1580,15 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                 }
             }
 
-            if (autoPlayQueue->count() > 0)
+            if (!autoPlayQueue->isEmpty())
+            {
                 this->autoPlayQueues.push_back(autoPlayQueue);
+                this->currentAutoPlayQueue = autoPlayQueue;
+
+                autoPlayQueue->start();
+            }
+            else
+                delete autoPlayQueue;
         }
         else
         {
@@ -1286,7 +1603,11 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                 }
             }
 
-            // Execute command on the selected item.
+            // Execute command on the selected item. The children are sent as one group, commands
+            // with equal delays fire together and mixer changes are committed at once.
+            DeviceManager::getInstance().beginGroup();
+            CommandScheduler::getInstance().beginBatch();
+
             for (int i = 0; i < currentItem->childCount(); i++)
             {
                 QWidget* childWidget = this->treeWidgetRundown->itemWidget(currentItem->child(i), 0);
@@ -1296,6 +1617,9 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                 dynamic_cast<AbstractPlayoutCommand*>(childWidget)->executeCommand(type);         
             }
 
+            CommandScheduler::getInstance().endBatch();
+            DeviceManager::getInstance().commitGroup();
+
             if (type == Playout::PlayoutType::Preview)
                 return true; // We are done.
         }
@@ -1326,7 +1650,7 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
         // The selected items parent is a group. If the group have AutoPlay property set, then play current item and below within the group.
         if (type == Playout::PlayoutType::Play && dynamic_cast<GroupCommand*>(rundownWidgetParent->getCommand())->getAutoPlay())
         {
-            QList<AbstractRundownWidget*>* autoPlayQueue = new QList<AbstractRundownWidget*>();
+            RundownAutoPlayQueue* autoPlayQueue = createAutoPlayQueue();
             for (int i = currentItem->parent()->indexOfChild(currentItem); i < currentItem->parent()->childCount(); i++)
             {
                 QWidget* childWidget = this->treeWidgetRundown->itemWidget(currentItem->parent()->child(i), 0);
@@ -1337,17 +1661,156 @@ bool RundownTreeWidget::executeCommand(Playout::PlayoutType type, Action::Action
                     if (!dynamic_cast<MovieCommand*>(rundownChildWidget->getCommand())->getAutoPlay())
                         continue;
 
-                    autoPlayQueue->push_back(rundownChildWidget); // Add our widget to the execution queue.
+                    // Taken over from a queue still working through the group.
+                    EventManager::getInstance().fireRemoveItemFromAutoPlayQueueEvent(RemoveItemFromAutoPlayQueueEvent(currentItem->parent()->child(i)));
+
+                    autoPlayQueue->append(rundownChildWidget); // Add our widget to the execution queue.
                 }
             }
 
-            this->autoPlayQueues.push_back(autoPlayQueue);
+            if (!autoPlayQueue->isEmpty())
+            {
+                this->autoPlayQueues.push_back(autoPlayQueue);
+                this->currentAutoPlayQueue = autoPlayQueue;
+
+                autoPlayQueue->start();
+            }
+            else
+                delete autoPlayQueue;
         }
     }
 
     return true;
 }
 
+QString RundownTreeWidget::getPrerollKey(AbstractRundownWidget* widget) const
+{
+    if (widget == NULL || widget->getCommand() == NULL || widget->getLibraryModel() == NULL || widget->getCommand()->getChannel() <= 0)
+        return QString();
+
+    return QString("%1-%2-%3").arg(widget->getLibraryModel()->getDeviceName()).arg(widget->getCommand()->getChannel()).arg(widget->getCommand()->getVideolayer());
+}
+
+void RundownTreeWidget::updatePrerolledLayers(Playout::PlayoutType type, QTreeWidgetItem* item)
+{
+    if (type == Playout::PlayoutType::Preview || type == Playout::PlayoutType::Update ||
+        type == Playout::PlayoutType::Invoke || type == Playout::PlayoutType::PauseResume)
+        return;
+
+    QList<QTreeWidgetItem*> items;
+    items.append(item);
+    for (int i = 0; i < item->childCount(); i++)
+        items.append(item->child(i));
+
+    foreach (QTreeWidgetItem* executedItem, items)
+    {
+        QWidget* widget = this->treeWidgetRundown->itemWidget(executedItem, 0);
+        QString key = getPrerollKey(dynamic_cast<AbstractRundownWidget*>(widget));
+        if (key.isEmpty())
+            continue;
+
+        // The background of the layer is played or replaced by this item.
+        QPointer<QWidget> prerolledWidget = this->prerolledLayers.take(key);
+        if (!prerolledWidget.isNull() && prerolledWidget != widget)
+            dynamic_cast<AbstractRundownWidget*>(prerolledWidget.data())->releasePreroll();
+
+        // A layer loaded by the operator is not pre-rolled until it is played or cleared.
+        if (type == Playout::PlayoutType::Load)
+            this->loadedLayers.insert(key);
+        else
+            this->loadedLayers.remove(key);
+    }
+
+    schedulePreroll();
+}
+
+void RundownTreeWidget::schedulePreroll()
+{
+    if (this->prerollItems <= 0 && this->prerolledLayers.isEmpty())
+        return;
+
+    // Restarted by every selection, only the item the operator settles on is loaded ahead.
+    this->prerollTimer.start();
+}
+
+void RundownTreeWidget::executePreroll()
+{
+    QHash<QString, QPointer<QWidget>> prerolledLayers;
+
+    QTreeWidgetItem* currentItem = this->treeWidgetRundown->currentItem();
+    if (this->active && this->prerollItems > 0 && currentItem != NULL)
+    {
+        // Layers an AutoPlay group is working through are left alone.
+        QSet<QString> claimedLayers = this->loadedLayers;
+        foreach (RundownAutoPlayQueue* autoPlayQueue, this->autoPlayQueues)
+        {
+            foreach (AbstractRundownWidget* widget, autoPlayQueue->getWidgets())
+                claimedLayers.insert(getPrerollKey(widget));
+        }
+
+        // Only the items close to the current one are looked at, the rest of the rundown is not scanned.
+        QTreeWidgetItem* topLevelItem = (currentItem->parent() != NULL) ? currentItem->parent() : currentItem;
+        int first = this->treeWidgetRundown->indexOfTopLevelItem(topLevelItem);
+        int last = qMin(first + Rundown::PREROLL_LOOKAHEAD, this->treeWidgetRundown->topLevelItemCount());
+        for (int i = first; i < last; i++)
+        {
+            if (prerolledLayers.count() >= this->prerollItems)
+                break;
+
+            QTreeWidgetItem* item = this->treeWidgetRundown->topLevelItem(i);
+
+            // Upcoming items may have been released while off screen.
+            this->treeWidgetRundown->wakeItem(item);
+
+            AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(item, 0));
+            if (widget == NULL)
+                continue;
+
+            if (!widget->isGroup())
+            {
+                prerollItem(item, claimedLayers, prerolledLayers);
+                continue;
+            }
+
+            // Items in a group are played together, starting with the selected child.
+            bool autoPlay = dynamic_cast<GroupCommand*>(widget->getCommand())->getAutoPlay();
+            int firstChild = (item == currentItem->parent()) ? item->indexOfChild(currentItem) : 0;
+            for (int j = firstChild; j < item->childCount() && prerolledLayers.count() < this->prerollItems; j++)
+            {
+                if (autoPlay)
+                    claimedLayers.insert(getPrerollKey(dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(item->child(j), 0))));
+                else
+                    prerollItem(item->child(j), claimedLayers, prerolledLayers);
+            }
+        }
+    }
+
+    // Items no longer next on their layer open their clip again when played.
+    for (QHash<QString, QPointer<QWidget>>::const_iterator i = this->prerolledLayers.constBegin(); i != this->prerolledLayers.constEnd(); ++i)
+    {
+        if (!i.value().isNull() && prerolledLayers.value(i.key()) != i.value())
+            dynamic_cast<AbstractRundownWidget*>(i.value().data())->releasePreroll();
+    }
+
+    this->prerolledLayers.swap(prerolledLayers);
+}
+
+void RundownTreeWidget::prerollItem(QTreeWidgetItem* item, QSet<QString>& claimedLayers, QHash<QString, QPointer<QWidget>>& prerolledLayers)
+{
+    QWidget* widget = this->treeWidgetRundown->itemWidget(item, 0);
+    AbstractRundownWidget* rundownWidget = dynamic_cast<AbstractRundownWidget*>(widget);
+
+    QString key = getPrerollKey(rundownWidget);
+    if (key.isEmpty() || claimedLayers.contains(key))
+        return;
+
+    // Only the first upcoming item on a layer can use its background, whether it is pre-rolled or not.
+    claimedLayers.insert(key);
+
+    if (rundownWidget->executePreroll())
+        prerolledLayers.insert(key, widget);
+}
+
 void RundownTreeWidget::selectItemBelow()
 {
     this->treeWidgetRundown->selectItemBelow();
@@ -1664,14 +2127,12 @@ void RundownTreeWidget::saveAsPreset()
 void RundownTreeWidget::removeItemFromAutoPlayQueue(const RemoveItemFromAutoPlayQueueEvent& event)
 {
     AbstractRundownWidget* widget = dynamic_cast<AbstractRundownWidget*>(this->treeWidgetRundown->itemWidget(event.getItem(), 0));
-    foreach (QList<AbstractRundownWidget*>* autoPlayQueue, this->autoPlayQueues)
+    foreach (RundownAutoPlayQueue* autoPlayQueue, this->autoPlayQueues)
     {
         if (autoPlayQueue->contains(widget))
         {
-            autoPlayQueue->removeOne(widget);
-
-            if (autoPlayQueue->isEmpty())
-                this->autoPlayQueues.removeOne(autoPlayQueue);
+            // An emptied queue finishes and is released.
+            autoPlayQueue->remove(widget);
 
             break;
         }
@@ -1685,6 +2146,8 @@ void RundownTreeWidget::clearCurrentPlayingItem(const ClearCurrentPlayingItemEve
 
     if (this->currentPlayingAutoStepItem == event.getItem())
         this->currentPlayingAutoStepItem = NULL;
+
+    this->delayedItems.remove(event.getItem());
 }
 
 void RundownTreeWidget::currentItemChanged(const CurrentItemChangedEvent& event)
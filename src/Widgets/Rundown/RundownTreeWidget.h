@@ -2,6 +2,8 @@
 
 #include "../Shared.h"
 #include "AbstractRundownWidget.h"
+#include "RundownAutoPlayQueue.h"
+#include "RundownJournal.h"
 #include "RundownTreeBaseWidget.h"
 #include "ui_RundownTreeWidget.h"
 
@@ -16,7 +18,6 @@
 #include "Events/Inspector/AutoPlayChangedEvent.h"
 #include "Events/Rundown/AddRudnownItemEvent.h"
 #include "Events/Rundown/AutoPlayNextRundownItemEvent.h"
-#include "Events/Rundown/AutoPlayRundownItemEvent.h"
 #include "Events/Rundown/CompactViewEvent.h"
 #include "Events/Rundown/ExecutePlayoutCommandEvent.h"
 #include "Events/Rundown/ExecuteRundownItemEvent.h"
@@ -34,9 +35,13 @@
 #include <boost/property_tree/xml_parser.hpp>
 
 #include <QtCore/QEvent>
+#include <QtCore/QHash>
 #include <QtCore/QMap>
 #include <QtCore/QObject>
+#include <QtCore/QPointer>
+#include <QtCore/QSet>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/QXmlStreamWriter>
 #include <QtCore/QSharedPointer>
 
@@ -53,6 +58,7 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
 
     public:
         explicit RundownTreeWidget(QWidget* parent = 0);
+        ~RundownTreeWidget();
 
         void setActive(bool active);
         void openRundown(const QString& path);
@@ -69,17 +75,27 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
 
         Q_SLOT void gpiBindingChanged(int, Playout::PlayoutType);
 
+    protected:
+        virtual bool eventFilter(QObject* target, QEvent* event);
+
     private:
         bool active;
         bool enterPressed;
+        bool navigating;
+        bool selectionPending;
         bool allowRemoteRundownTriggering;
         bool repositoryRundown;
         bool previewOnAutoStep;
         bool clearDelayedCommandsOnAutoStep;
+        int prerollItems;
+        int autoPlayPretriggerFrames;
+        QString delayType;
 
         QString page;
         QString activeRundown;
-        QString hexHash;
+        int savedChangeCount;
+        QList<int> compactChangeCounts;
+        RundownJournal journal;
 
         QMenu* contextMenuTools;
         QMenu* contextMenuColor;
@@ -96,13 +112,21 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
 
         QMap<int, Playout::PlayoutType> gpiBindings;
 
-        AbstractRundownWidget* currentAutoPlayWidget;
-        QList<QList<AbstractRundownWidget*>* > autoPlayQueues;
+        QPointer<RundownAutoPlayQueue> currentAutoPlayQueue;
+        QList<RundownAutoPlayQueue*> autoPlayQueues;
 
         QTreeWidgetItem* copyItem;
         QTreeWidgetItem* currentPlayingItem;
         QTreeWidgetItem* currentPlayingAutoStepItem;
 
+        QHash<QString, QPointer<QWidget>> prerolledLayers;
+        QSet<QString> loadedLayers;
+
+        QTimer prerollTimer;
+        QTimer hibernateTimer;
+        QTimer releaseTimer;
+        QHash<QTreeWidgetItem*, qint64> delayedItems;
+
         OscSubscription* upControlSubscription;
         OscSubscription* downControlSubscription;
         OscSubscription* playAndAutoStepControlSubscription;
@@ -132,6 +156,17 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         void resetOscSubscriptions();
         void configureOscSubscriptions();
         QString colorLookup(const QString& color, bool reverse) const;
+        QString getPrerollKey(AbstractRundownWidget* widget) const;
+        void prerollItem(QTreeWidgetItem* item, QSet<QString>& claimedLayers, QHash<QString, QPointer<QWidget>>& prerolledLayers);
+        void updatePrerolledLayers(Playout::PlayoutType type, QTreeWidgetItem* item);
+        void fireItemSelected();
+        void settleNavigation();
+        RundownAutoPlayQueue* createAutoPlayQueue();
+        void clearAutoPlayQueues();
+        void discardCompactions();
+        void trackDelayedItem(QTreeWidgetItem* item);
+        qint64 getPendingTime(QTreeWidgetItem* item, bool includeDelay) const;
+        QSet<QTreeWidgetItem*> getLiveItems() const;
 
         Q_SLOT void addAtemFadeToBlackItem();
         Q_SLOT void addPlayoutCommandItem();
@@ -195,12 +230,21 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         Q_SLOT void customContextMenuRequested(const QPoint&);
         Q_SLOT void gpiPortTriggered(int, GpiDevice*);
         Q_SLOT void currentItemChanged(QTreeWidgetItem*, QTreeWidgetItem*);
+        Q_SLOT void currentItemModified();
         Q_SLOT void itemDoubleClicked(QTreeWidgetItem*, int);
         Q_SLOT void itemClicked(QTreeWidgetItem*, int);
         Q_SLOT void itemSelectionChanged();
         Q_SLOT void contextMenuNewTriggered(QAction*);
         Q_SLOT void selectItemBelow();
         Q_SLOT void executePreview();
+        Q_SLOT void schedulePreroll();
+        Q_SLOT void executePreroll();
+        Q_SLOT void autoPlayQueueFinished();
+        Q_SLOT void journalCompacted(bool, const QString&);
+        Q_SLOT void hibernate();
+        Q_SLOT void scheduleRelease();
+        Q_SLOT void loadCancelled();
+        Q_SLOT void releaseDelayedItems();
         Q_SLOT bool removeSelectedItems();
         Q_SLOT void saveAsPreset();
         Q_SLOT void addOscOutputItem();
@@ -213,7 +257,6 @@ class WIDGETS_EXPORT RundownTreeWidget : public QWidget, Ui::RundownTreeWidget
         Q_SLOT void toggleCompactView(const CompactViewEvent&);
         Q_SLOT void executeRundownItem(const ExecuteRundownItemEvent&);
         Q_SLOT void allowRemoteTriggering(const AllowRemoteTriggeringEvent&);
-        Q_SLOT void autoPlayRundownItem(const AutoPlayRundownItemEvent&);
         Q_SLOT void autoPlayChanged(const AutoPlayChangedEvent&);
         Q_SLOT void autoPlayNextRundownItem(const AutoPlayNextRundownItemEvent&);
         Q_SLOT void playAndAutoStepControlSubscriptionReceived(const QString&, const QList<QVariant>&);
@@ -471,8 +471,12 @@ void RundownWidget::tabCloseRequested(int index)
 
 void RundownWidget::currentChanged(int index)
 {
+    // The current rundown is left alone, deactivating it would hibernate and wake it right away.
     for (int i = 0; i < this->tabWidgetRundown->count(); i++)
-        dynamic_cast<RundownTreeWidget*>(this->tabWidgetRundown->widget(i))->setActive(false);
+    {
+        if (i != index)
+            dynamic_cast<RundownTreeWidget*>(this->tabWidgetRundown->widget(i))->setActive(false);
+    }
 
     dynamic_cast<RundownTreeWidget*>(this->tabWidgetRundown->widget(index))->setActive(true);
 
@@ -174,6 +174,8 @@ void RundownSonyPresetWidget::clearDelayedCommands()
 
 void RundownSonyPresetWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -188,6 +190,11 @@ void RundownSonyPresetWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownSonyPresetWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownSonyPresetWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
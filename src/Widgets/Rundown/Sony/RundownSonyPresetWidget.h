@@ -11,6 +11,7 @@
 #include "GpiDevice.h"
 
 #include "OscSubscription.h"
+#include "ScheduledTimer.h"
 #include "Animations/ActiveAnimation.h"
 #include "Commands/AbstractCommand.h"
 #include "Commands/AbstractPlayoutCommand.h"
@@ -51,6 +52,7 @@ class WIDGETS_EXPORT RundownSonyPresetWidget : public QWidget, Ui::RundownSonyPr
         virtual void setCompactView(bool compactView);
         virtual void clearDelayedCommands();
         virtual void setUsed(bool used);
+        virtual bool isUsed() const;
         virtual void setSelected(bool selected);
 
     private:
@@ -63,6 +65,7 @@ class WIDGETS_EXPORT RundownSonyPresetWidget : public QWidget, Ui::RundownSonyPr
         ActiveAnimation* animation;
         bool markUsedItems;
         bool selected = false;
+        bool used = false;
 
         OscSubscription* stopControlSubscription;
         OscSubscription* playControlSubscription;
@@ -72,7 +75,7 @@ class WIDGETS_EXPORT RundownSonyPresetWidget : public QWidget, Ui::RundownSonyPr
         OscSubscription* clearVideolayerControlSubscription;
         OscSubscription* clearChannelControlSubscription;
 
-        QTimer executeTimer;
+        ScheduledTimer executeTimer;
         ViscaDevice* device;
 
         void checkGpiConnection();
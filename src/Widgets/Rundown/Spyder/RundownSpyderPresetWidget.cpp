@@ -174,6 +174,8 @@ void RundownSpyderPresetWidget::clearDelayedCommands()
 
 void RundownSpyderPresetWidget::setUsed(bool used)
 {
+    this->used = used;
+
     if (used)
     {
         if (this->frameItem->graphicsEffect() == NULL)
@@ -188,6 +190,11 @@ void RundownSpyderPresetWidget::setUsed(bool used)
         this->frameItem->setGraphicsEffect(NULL);
 }
 
+bool RundownSpyderPresetWidget::isUsed() const
+{
+    return this->used;
+}
+
 bool RundownSpyderPresetWidget::executeCommand(Playout::PlayoutType type)
 {
     if (type == Playout::PlayoutType::Stop)
@@ -77,6 +77,8 @@ SettingsDialog::SettingsDialog(QWidget* parent)
     this->lineEditOscInputPort->setEnabled(enableOscInput);
     this->labelOscWebSocketPort->setEnabled(enableOscInput);
     this->lineEditOscWebSocketInputPort->setEnabled(enableOscInput);
+    this->labelOscTcpPort->setEnabled(enableOscInput);
+    this->lineEditOscTcpInputPort->setEnabled(enableOscInput);
 
     bool disableInAndOutPoints = (DatabaseManager::getInstance().getConfigurationByName("DisableInAndOutPoints").getValue() == "true") ? true : false;
     this->checkBoxDisableInAndOutPoints->setChecked(disableInAndOutPoints);
@@ -91,6 +93,8 @@ SettingsDialog::SettingsDialog(QWidget* parent)
     this->checkBoxPreviewOnAutoStep->setChecked(previewOnAutoStep);
     bool clearDelayedCommandsOnAutoStep = (DatabaseManager::getInstance().getConfigurationByName("ClearDelayedCommandsOnAutoStep").getValue() == "true") ? true : false;
     this->checkBoxClearDelayedCommandsOnAutoStep->setChecked(clearDelayedCommandsOnAutoStep);
+    this->spinBoxPrerollItems->setValue(DatabaseManager::getInstance().getConfigurationByName("PrerollItems").getValue().toInt());
+    this->spinBoxAutoPlayPretriggerFrames->setValue(DatabaseManager::getInstance().getConfigurationByName("AutoPlayPretriggerFrames").getValue().toInt());
     bool markUsedItems = (DatabaseManager::getInstance().getConfigurationByName("MarkUsedItems").getValue() == "true") ? true : false;
     this->checkBoxMarkUsedItems->setChecked(markUsedItems);
 
@@ -129,6 +133,16 @@ SettingsDialog::SettingsDialog(QWidget* parent)
     if (!oscWebSocketPort.isEmpty())
         this->lineEditOscWebSocketInputPort->setText(oscWebSocketPort);
 
+    this->lineEditOscTcpInputPort->setPlaceholderText(QString("%1").arg(Osc::DEFAULT_TCP_PORT));
+    QString oscTcpPort = DatabaseManager::getInstance().getConfigurationByName("OscTcpPort").getValue();
+    if (!oscTcpPort.isEmpty())
+        this->lineEditOscTcpInputPort->setText(oscTcpPort);
+
+    this->lineEditLiveDataUrl->setText(DatabaseManager::getInstance().getConfigurationByName("LiveDataUrl").getValue());
+    this->spinBoxLiveDataPollInterval->setValue(DatabaseManager::getInstance().getConfigurationByName("LiveDataPollInterval").getValue().toInt());
+    this->spinBoxLiveDataUpdateInterval->setValue(DatabaseManager::getInstance().getConfigurationByName("LiveDataUpdateInterval").getValue().toInt());
+    this->lineEditLiveDataFile->setText(DatabaseManager::getInstance().getConfigurationByName("LiveDataFile").getValue());
+
     loadDevice();
     loadTriCasterDevice();
     loadAtemDevice();
@@ -674,6 +688,8 @@ void SettingsDialog::enableOscInputChanged(int state)
 
     this->labelOscPort->setEnabled((state == Qt::Checked) ? true : false);
     this->lineEditOscInputPort->setEnabled((state == Qt::Checked) ? true : false);
+    this->labelOscTcpPort->setEnabled((state == Qt::Checked) ? true : false);
+    this->lineEditOscTcpInputPort->setEnabled((state == Qt::Checked) ? true : false);
 }
 
 void SettingsDialog::disableInAndOutPointsChanged(int state)
@@ -848,6 +864,15 @@ void SettingsDialog::oscWebSocketPortChanged()
     DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "OscWebSocketPort", oscWebSocketPort));
 }
 
+void SettingsDialog::oscTcpPortChanged()
+{
+    QString oscTcpPort = this->lineEditOscTcpInputPort->text().trimmed();
+    if (oscTcpPort.isEmpty())
+        oscTcpPort = QString("%1").arg(Osc::DEFAULT_TCP_PORT);
+
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "OscTcpPort", oscTcpPort));
+}
+
 void SettingsDialog::streamPortChanged()
 {
     QString streamPort = this->lineEditStreamPort->text().trimmed();
@@ -909,6 +934,36 @@ void SettingsDialog::clearDelayedCommandsOnAutoStepChanged(int state)
     DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "ClearDelayedCommandsOnAutoStep", clearDelayedCommandsOnAutoStep));
 }
 
+void SettingsDialog::prerollItemsChanged(int items)
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "PrerollItems", QString("%1").arg(items)));
+}
+
+void SettingsDialog::autoPlayPretriggerFramesChanged(int frames)
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "AutoPlayPretriggerFrames", QString("%1").arg(frames)));
+}
+
+void SettingsDialog::liveDataUrlChanged()
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "LiveDataUrl", this->lineEditLiveDataUrl->text().trimmed()));
+}
+
+void SettingsDialog::liveDataPollIntervalChanged(int interval)
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "LiveDataPollInterval", QString("%1").arg(interval)));
+}
+
+void SettingsDialog::liveDataUpdateIntervalChanged(int interval)
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "LiveDataUpdateInterval", QString("%1").arg(interval)));
+}
+
+void SettingsDialog::liveDataFileChanged()
+{
+    DatabaseManager::getInstance().updateConfiguration(ConfigurationModel(0, "LiveDataFile", this->lineEditLiveDataFile->text().trimmed()));
+}
+
 void SettingsDialog::storeThumbnailsInDatabaseChanged(int state)
 {
     QString storeThumbnailsInDatabase = (state == Qt::Checked) ? "true" : "false";
@@ -74,6 +74,7 @@ class WIDGETS_EXPORT SettingsDialog : public QDialog, Ui::SettingsDialog
         Q_SLOT void baudRateChanged(QString);
         Q_SLOT void oscPortChanged();
         Q_SLOT void oscWebSocketPortChanged();
+        Q_SLOT void oscTcpPortChanged();
         Q_SLOT void repositoryPortChanged();
         Q_SLOT void showImportDeviceDialog();
         Q_SLOT void showImportTriCasterDeviceDialog();
@@ -88,6 +89,12 @@ class WIDGETS_EXPORT SettingsDialog : public QDialog, Ui::SettingsDialog
         Q_SLOT void rundownRepositoryChanged();
         Q_SLOT void previewOnAutoStepChanged(int);
         Q_SLOT void clearDelayedCommandsOnAutoStepChanged(int);
+        Q_SLOT void prerollItemsChanged(int);
+        Q_SLOT void autoPlayPretriggerFramesChanged(int);
+        Q_SLOT void liveDataUrlChanged();
+        Q_SLOT void liveDataPollIntervalChanged(int);
+        Q_SLOT void liveDataUpdateIntervalChanged(int);
+        Q_SLOT void liveDataFileChanged();
         Q_SLOT void deleteThumbnails();
         Q_SLOT void storeThumbnailsInDatabaseChanged(int);
         Q_SLOT void markUsedItemsChanged(int);
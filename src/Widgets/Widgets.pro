@@ -70,6 +70,10 @@ HEADERS += \
     OscTimeWidget.h \
     Action/ActionWidget.h \
     Rundown/RundownTreeBaseWidget.h \
+    Rundown/RundownItemDelegate.h \
+    Rundown/RundownJournal.h \
+    Rundown/RundownAutoPlayQueue.h \
+    Rundown/RundownReader.h \
     Library/DataTreeBaseWidget.h \
     Library/ToolTreeBaseWidget.h \
     Library/AudioTreeBaseWidget.h \
@@ -228,6 +232,10 @@ SOURCES += \
     OscTimeWidget.cpp \
     Action/ActionWidget.cpp \
     Rundown/RundownTreeBaseWidget.cpp \
+    Rundown/RundownItemDelegate.cpp \
+    Rundown/RundownJournal.cpp \
+    Rundown/RundownAutoPlayQueue.cpp \
+    Rundown/RundownReader.cpp \
     Library/DataTreeBaseWidget.cpp \
     Library/ToolTreeBaseWidget.cpp \
     Library/AudioTreeBaseWidget.cpp \
@@ -423,7 +431,6 @@ FORMS += \
     Inspector/Atem/InspectorAtemAudioInputBalanceWidget.ui \
     Inspector/Atem/InspectorAtemAudioGainWidget.ui \
     Rundown/OpenRundownFromUrlDialog.ui \
-    AudioMeterWidget.ui \
     AudioLevelsWidget.ui \
     LiveWidget.ui \
     Rundown/RundownPlayoutCommandWidget.ui \